@@ -2946,4 +2946,137 @@ TEST_F(test_ogr, importFromWkbReuse)
     }
 }
 
+static OGRLinearRing *MakeLinearRing(double dfOffset)
+{
+    auto poRing = new OGRLinearRing();
+    poRing->addPoint(dfOffset, dfOffset);
+    poRing->addPoint(dfOffset, dfOffset + 1);
+    poRing->addPoint(dfOffset + 1, dfOffset + 1);
+    poRing->addPoint(dfOffset, dfOffset);
+    return poRing;
+}
+
+static OGRLineString *MakeClosedLineString(double dfOffset)
+{
+    auto poLS = new OGRLineString();
+    poLS->addPoint(dfOffset, dfOffset);
+    poLS->addPoint(dfOffset, dfOffset + 1);
+    poLS->addPoint(dfOffset + 1, dfOffset + 1);
+    poLS->addPoint(dfOffset, dfOffset);
+    return poLS;
+}
+
+// Test OGRGeometryCollection::reserve()
+TEST_F(test_ogr, OGRGeometryCollection_reserve)
+{
+    OGRGeometryCollection oGC;
+    EXPECT_EQ(oGC.reserve(2), OGRERR_NONE);
+    // Reserving less than the current capacity is a no-op
+    EXPECT_EQ(oGC.reserve(0), OGRERR_NONE);
+    // Add up to and past the reserved count
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(oGC.addGeometryDirectly(new OGRPoint(i, i)), OGRERR_NONE);
+    }
+    ASSERT_EQ(oGC.getNumGeometries(), 4);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(oGC.getGeometryRef(i)->toPoint()->getX(), i);
+    }
+    // Reserving less than the current count is also a no-op
+    EXPECT_EQ(oGC.reserve(1), OGRERR_NONE);
+    ASSERT_EQ(oGC.getNumGeometries(), 4);
+    EXPECT_EQ(oGC.addGeometryDirectly(new OGRPoint(4, 4)), OGRERR_NONE);
+    ASSERT_EQ(oGC.getNumGeometries(), 5);
+}
+
+// Test OGRPolygon::reserveRings()
+TEST_F(test_ogr, OGRPolygon_reserveRings)
+{
+    OGRPolygon oPoly;
+    EXPECT_EQ(oPoly.reserveRings(1), OGRERR_NONE);
+    // Add up to and past the reserved count
+    EXPECT_EQ(oPoly.addRingDirectly(MakeLinearRing(0.0)), OGRERR_NONE);
+    EXPECT_EQ(oPoly.addRingDirectly(MakeLinearRing(0.2)), OGRERR_NONE);
+    EXPECT_EQ(oPoly.addRingDirectly(MakeLinearRing(0.4)), OGRERR_NONE);
+    ASSERT_TRUE(oPoly.getExteriorRing() != nullptr);
+    EXPECT_EQ(oPoly.getNumInteriorRings(), 2);
+    // Reserving less than the current count is a no-op
+    EXPECT_EQ(oPoly.reserveRings(0), OGRERR_NONE);
+    EXPECT_EQ(oPoly.getNumInteriorRings(), 2);
+}
+
+// Test OGRCurvePolygon::reserveRings(), which exercises
+// OGRCurveCollection::reserve()
+TEST_F(test_ogr, OGRCurvePolygon_reserveRings)
+{
+    OGRCurvePolygon oCP;
+    EXPECT_EQ(oCP.reserveRings(1), OGRERR_NONE);
+    // Add up to and past the reserved count
+    EXPECT_EQ(oCP.addRingDirectly(MakeClosedLineString(0.0)), OGRERR_NONE);
+    EXPECT_EQ(oCP.addRingDirectly(MakeClosedLineString(0.2)), OGRERR_NONE);
+    EXPECT_EQ(oCP.addRingDirectly(MakeClosedLineString(0.4)), OGRERR_NONE);
+    ASSERT_TRUE(oCP.getExteriorRingCurve() != nullptr);
+    EXPECT_EQ(oCP.getNumInteriorRings(), 2);
+    // Reserving less than the current count is a no-op
+    EXPECT_EQ(oCP.reserveRings(0), OGRERR_NONE);
+    EXPECT_EQ(oCP.getNumInteriorRings(), 2);
+}
+
+// Test that the capacity reserved by reserve() / reserveRings() remains
+// consistent through the member-stealing casts, by adding further
+// elements afterwards
+TEST_F(test_ogr, reserve_transfer_through_casts)
+{
+    {
+        // OGRPolygon::CastToCurvePolygon()
+        auto poPoly = new OGRPolygon();
+        EXPECT_EQ(poPoly->reserveRings(3), OGRERR_NONE);
+        EXPECT_EQ(poPoly->addRingDirectly(MakeLinearRing(0.0)), OGRERR_NONE);
+        OGRCurvePolygon *poCP = OGRSurface::CastToCurvePolygon(poPoly);
+        ASSERT_TRUE(poCP != nullptr);
+        EXPECT_EQ(poCP->addRingDirectly(MakeClosedLineString(0.2)),
+                  OGRERR_NONE);
+        EXPECT_EQ(poCP->addRingDirectly(MakeClosedLineString(0.4)),
+                  OGRERR_NONE);
+        EXPECT_EQ(poCP->addRingDirectly(MakeClosedLineString(0.6)),
+                  OGRERR_NONE);
+        EXPECT_EQ(poCP->getNumInteriorRings(), 3);
+        delete poCP;
+    }
+    {
+        // OGRCurvePolygon::CastToPolygon()
+        auto poCP = new OGRCurvePolygon();
+        EXPECT_EQ(poCP->reserveRings(3), OGRERR_NONE);
+        EXPECT_EQ(poCP->addRingDirectly(MakeClosedLineString(0.0)),
+                  OGRERR_NONE);
+        OGRPolygon *poPoly = OGRSurface::CastToPolygon(poCP);
+        ASSERT_TRUE(poPoly != nullptr);
+        EXPECT_EQ(poPoly->addRingDirectly(MakeLinearRing(0.2)), OGRERR_NONE);
+        EXPECT_EQ(poPoly->addRingDirectly(MakeLinearRing(0.4)), OGRERR_NONE);
+        EXPECT_EQ(poPoly->addRingDirectly(MakeLinearRing(0.6)), OGRERR_NONE);
+        EXPECT_EQ(poPoly->getNumInteriorRings(), 3);
+        delete poPoly;
+    }
+    {
+        // TransferMembersAndDestroy(), through
+        // OGRMultiPolygon::CastToMultiSurface()
+        auto poMP = new OGRMultiPolygon();
+        EXPECT_EQ(poMP->reserve(3), OGRERR_NONE);
+        auto poPoly = new OGRPolygon();
+        poPoly->addRingDirectly(MakeLinearRing(0.0));
+        EXPECT_EQ(poMP->addGeometryDirectly(poPoly), OGRERR_NONE);
+        OGRMultiSurface *poMS = OGRMultiPolygon::CastToMultiSurface(poMP);
+        ASSERT_TRUE(poMS != nullptr);
+        for (int i = 1; i <= 3; ++i)
+        {
+            auto poNewPoly = new OGRPolygon();
+            poNewPoly->addRingDirectly(MakeLinearRing(i));
+            EXPECT_EQ(poMS->addGeometryDirectly(poNewPoly), OGRERR_NONE);
+        }
+        EXPECT_EQ(poMS->getNumGeometries(), 4);
+        delete poMS;
+    }
+}
+
 }  // namespace
@@ -110,3 +110,225 @@ INSTANTIATE_TEST_SUITE_P(
     [](const ::testing::TestParamInfo<
         OGRWKBFixupCounterClockWiseExternalRingFixture::ParamType> &l_info)
     { return std::get<2>(l_info.param); });
+
+#if CPL_IS_LSB
+constexpr OGRwkbByteOrder kNativeOrder = wkbNDR;
+constexpr OGRwkbByteOrder kSwappedOrder = wkbXDR;
+#else
+constexpr OGRwkbByteOrder kNativeOrder = wkbXDR;
+constexpr OGRwkbByteOrder kSwappedOrder = wkbNDR;
+#endif
+
+static std::vector<GByte> WkbFromWkt(const char *pszWKT,
+                                     OGRwkbByteOrder eByteOrder)
+{
+    OGRGeometry *poGeom = nullptr;
+    OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom);
+    CPLAssert(poGeom != nullptr);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+    delete poGeom;
+    return abyWkb;
+}
+
+static void AppendUInt32(std::vector<GByte> &abyWkb, uint32_t nVal)
+{
+    const size_t nSize = abyWkb.size();
+    abyWkb.resize(nSize + sizeof(nVal));
+    memcpy(abyWkb.data() + nSize, &nVal, sizeof(nVal));
+}
+
+class OGRWKBCreateGeometryFastFixture
+    : public test_ogr_wkb,
+      public ::testing::WithParamInterface<std::tuple<const char *,
+                                                      const char *>>
+{
+  public:
+    static std::vector<std::tuple<const char *, const char *>>
+    GetTupleValues()
+    {
+        return {
+            std::make_tuple("POINT (1 2)", "POINT_2D"),
+            std::make_tuple("POINT Z (1 2 3)", "POINT_Z"),
+            std::make_tuple("POINT M (1 2 3)", "POINT_M"),
+            std::make_tuple("POINT ZM (1 2 3 4)", "POINT_ZM"),
+            std::make_tuple("LINESTRING (1 2,3 4,5 6)", "LINESTRING_2D"),
+            std::make_tuple("LINESTRING EMPTY", "LINESTRING_EMPTY"),
+            std::make_tuple("POLYGON ((0 0,0 1,1 1,0 0))", "POLYGON_2D"),
+            std::make_tuple("POLYGON ((0 0,0 1,1 1,0 0),(0.2 0.3,0.2 "
+                            "0.8,0.7 0.8,0.2 0.3))",
+                            "POLYGON_2D_TWO_RINGS"),
+            std::make_tuple("POLYGON EMPTY", "POLYGON_EMPTY"),
+        };
+    }
+};
+
+TEST_P(OGRWKBCreateGeometryFastFixture, test)
+{
+    const char *pszInput = std::get<0>(GetParam());
+    const std::vector<GByte> abyWkb = WkbFromWkt(pszInput, kNativeOrder);
+
+    OGRGeometry *poFastGeom =
+        OGRWKBCreateGeometryFast(abyWkb.data(), abyWkb.size());
+    ASSERT_TRUE(poFastGeom != nullptr);
+
+    // The fast path must agree with the generic parser
+    OGRGeometry *poRefGeom = nullptr;
+    ASSERT_EQ(OGRGeometryFactory::createFromWkb(abyWkb.data(), nullptr,
+                                                &poRefGeom, abyWkb.size()),
+              OGRERR_NONE);
+    EXPECT_EQ(poFastGeom->getGeometryType(), poRefGeom->getGeometryType());
+    char *pszFastWKT = nullptr;
+    poFastGeom->exportToWkt(&pszFastWKT, wkbVariantIso);
+    char *pszRefWKT = nullptr;
+    poRefGeom->exportToWkt(&pszRefWKT, wkbVariantIso);
+    EXPECT_STREQ(pszFastWKT, pszRefWKT);
+    CPLFree(pszFastWKT);
+    CPLFree(pszRefWKT);
+    delete poFastGeom;
+    delete poRefGeom;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_ogr_wkb, OGRWKBCreateGeometryFastFixture,
+    ::testing::ValuesIn(OGRWKBCreateGeometryFastFixture::GetTupleValues()),
+    [](const ::testing::TestParamInfo<
+        OGRWKBCreateGeometryFastFixture::ParamType> &l_info)
+    { return std::get<1>(l_info.param); });
+
+TEST_F(test_ogr_wkb, OGRWKBCreateGeometryFast_zero_point_ring)
+{
+    std::vector<GByte> abyWkb;
+    abyWkb.push_back(static_cast<GByte>(kNativeOrder));
+    AppendUInt32(abyWkb, wkbPolygon);
+    AppendUInt32(abyWkb, 1);  // number of rings
+    AppendUInt32(abyWkb, 0);  // number of points of the only ring
+    OGRGeometry *poGeom = OGRWKBCreateGeometryFast(abyWkb.data(),
+                                                   abyWkb.size());
+    ASSERT_TRUE(poGeom != nullptr);
+    ASSERT_EQ(poGeom->getGeometryType(), wkbPolygon);
+    const OGRPolygon *poPoly = poGeom->toPolygon();
+    EXPECT_EQ(poPoly->getNumInteriorRings(), 0);
+    ASSERT_TRUE(poPoly->getExteriorRing() != nullptr);
+    EXPECT_EQ(poPoly->getExteriorRing()->getNumPoints(), 0);
+    delete poGeom;
+}
+
+TEST_F(test_ogr_wkb, OGRWKBCreateGeometryFast_fallback)
+{
+    {
+        // POINT EMPTY (NaN coordinates): left to the generic parser
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("POINT EMPTY", kNativeOrder);
+        EXPECT_EQ(OGRWKBCreateGeometryFast(abyWkb.data(), abyWkb.size()),
+                  nullptr);
+    }
+    {
+        // Non-native byte order
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("POINT (1 2)", kSwappedOrder);
+        EXPECT_EQ(OGRWKBCreateGeometryFast(abyWkb.data(), abyWkb.size()),
+                  nullptr);
+    }
+    {
+        // EWKB Z flag instead of the ISO type code
+        std::vector<GByte> abyWkb = WkbFromWkt("POINT Z (1 2 3)",
+                                               kNativeOrder);
+        const uint32_t nEWKBType = wkbPoint | 0x80000000U;
+        memcpy(abyWkb.data() + 1, &nEWKBType, sizeof(nEWKBType));
+        EXPECT_EQ(OGRWKBCreateGeometryFast(abyWkb.data(), abyWkb.size()),
+                  nullptr);
+    }
+    {
+        // Truncated point
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("POINT ZM (1 2 3 4)", kNativeOrder);
+        EXPECT_EQ(OGRWKBCreateGeometryFast(abyWkb.data(), abyWkb.size() - 1),
+                  nullptr);
+        EXPECT_EQ(OGRWKBCreateGeometryFast(abyWkb.data(), 8), nullptr);
+    }
+    {
+        // Line string whose declared point count overflows the buffer
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("LINESTRING (1 2,3 4)", kNativeOrder);
+        EXPECT_EQ(OGRWKBCreateGeometryFast(abyWkb.data(), abyWkb.size() - 1),
+                  nullptr);
+    }
+    {
+        // Polygon truncated before the ring point count, and within the
+        // ring coordinates
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("POLYGON ((0 0,0 1,1 1,0 0))", kNativeOrder);
+        EXPECT_EQ(OGRWKBCreateGeometryFast(abyWkb.data(), 11), nullptr);
+        EXPECT_EQ(OGRWKBCreateGeometryFast(abyWkb.data(), abyWkb.size() - 1),
+                  nullptr);
+    }
+    {
+        // Unhandled geometry type: left to the generic parser
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("MULTIPOINT ((1 2))", kNativeOrder);
+        EXPECT_EQ(OGRWKBCreateGeometryFast(abyWkb.data(), abyWkb.size()),
+                  nullptr);
+    }
+}
+
+TEST_F(test_ogr_wkb, OGRWKBPointGetBoundingBoxFast)
+{
+    const std::vector<GByte> abyWkb = WkbFromWkt("POINT (1 2)", kNativeOrder);
+    OGREnvelope sEnvelope;
+    EXPECT_TRUE(
+        OGRWKBPointGetBoundingBoxFast(abyWkb.data(), abyWkb.size(),
+                                      sEnvelope));
+    // The fast path must agree with the generic implementation
+    OGREnvelope sRefEnvelope;
+    EXPECT_TRUE(OGRWKBGetBoundingBox(abyWkb.data(), abyWkb.size(),
+                                     sRefEnvelope));
+    EXPECT_EQ(sEnvelope.MinX, sRefEnvelope.MinX);
+    EXPECT_EQ(sEnvelope.MinY, sRefEnvelope.MinY);
+    EXPECT_EQ(sEnvelope.MaxX, sRefEnvelope.MaxX);
+    EXPECT_EQ(sEnvelope.MaxY, sRefEnvelope.MaxY);
+    EXPECT_EQ(sEnvelope.MinX, 1.0);
+    EXPECT_EQ(sEnvelope.MinY, 2.0);
+    EXPECT_EQ(sEnvelope.MaxX, 1.0);
+    EXPECT_EQ(sEnvelope.MaxY, 2.0);
+}
+
+TEST_F(test_ogr_wkb, OGRWKBPointGetBoundingBoxFast_fallback)
+{
+    OGREnvelope sEnvelope;
+    {
+        // POINT EMPTY (NaN coordinates): left to the generic implementation
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("POINT EMPTY", kNativeOrder);
+        EXPECT_FALSE(OGRWKBPointGetBoundingBoxFast(abyWkb.data(),
+                                                   abyWkb.size(), sEnvelope));
+    }
+    {
+        // Non-native byte order
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("POINT (1 2)", kSwappedOrder);
+        EXPECT_FALSE(OGRWKBPointGetBoundingBoxFast(abyWkb.data(),
+                                                   abyWkb.size(), sEnvelope));
+    }
+    {
+        // Truncated point
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("POINT (1 2)", kNativeOrder);
+        EXPECT_FALSE(OGRWKBPointGetBoundingBoxFast(
+            abyWkb.data(), abyWkb.size() - 1, sEnvelope));
+    }
+    {
+        // Non 2D point
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("POINT Z (1 2 3)", kNativeOrder);
+        EXPECT_FALSE(OGRWKBPointGetBoundingBoxFast(abyWkb.data(),
+                                                   abyWkb.size(), sEnvelope));
+    }
+    {
+        // Non point geometry
+        const std::vector<GByte> abyWkb =
+            WkbFromWkt("LINESTRING (1 2,3 4)", kNativeOrder);
+        EXPECT_FALSE(OGRWKBPointGetBoundingBoxFast(abyWkb.data(),
+                                                   abyWkb.size(), sEnvelope));
+    }
+}
@@ -1974,6 +1974,10 @@ class CPL_DLL OGRCurveCollection
     friend class OGRTriangle;
 
     int nCurveCount = 0;
+    // Number of entries allocated in papoCurves. Code updating papoCurves
+    // without updating nCurveCapacity must make sure it never overstates
+    // the actual allocation (understating it is safe).
+    int nCurveCapacity = 0;
     OGRCurve **papoCurves = nullptr;
 
   public:
@@ -2018,6 +2022,7 @@ class CPL_DLL OGRCurveCollection
 
     OGRErr addCurveDirectly(OGRGeometry *poGeom, OGRCurve *poCurve,
                             int bNeedRealloc);
+    OGRErr reserve(int nCurveCountIn);
     size_t WkbSize() const;
     OGRErr importPreambleFromWkb(OGRGeometry *poGeom,
                                  const unsigned char *pabyData, size_t &nSize,
@@ -2435,6 +2440,7 @@ class CPL_DLL OGRCurvePolygon : public OGRSurface
     virtual OGRErr addRing(OGRCurve *);
     virtual OGRErr addRingDirectly(OGRCurve *);
     OGRErr addRing(std::unique_ptr<OGRCurve>);
+    OGRErr reserveRings(int nRingCount);
 
     OGRCurve *getExteriorRingCurve();
     const OGRCurve *getExteriorRingCurve() const;
@@ -2747,6 +2753,10 @@ class CPL_DLL OGRGeometryCollection : public OGRGeometry
   protected:
     //! @cond Doxygen_Suppress
     int nGeomCount = 0;
+    // Number of entries allocated in papoGeoms. Code updating papoGeoms
+    // without updating nGeomCapacity must make sure it never overstates
+    // the actual allocation (understating it is safe).
+    int nGeomCapacity = 0;
     OGRGeometry **papoGeoms = nullptr;
 
     std::string
@@ -2861,6 +2871,7 @@ class CPL_DLL OGRGeometryCollection : public OGRGeometry
     virtual OGRErr addGeometry(const OGRGeometry *);
     virtual OGRErr addGeometryDirectly(OGRGeometry *);
     OGRErr addGeometry(std::unique_ptr<OGRGeometry> geom);
+    OGRErr reserve(int nGeomCountIn);
     virtual OGRErr removeGeometry(int iIndex, int bDelete = TRUE);
 
     virtual void
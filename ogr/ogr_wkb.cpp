@@ -523,6 +523,142 @@ bool OGRWKBGetBoundingBox(const GByte *pabyWkb, size_t nWKBSize,
     return OGRWKBGetBoundingBox(pabyWkb, nWKBSize, iOffset, sEnvelope, 0);
 }
 
+/************************************************************************/
+/*                      OGRWKBCreateGeometryFast()                      */
+/************************************************************************/
+
+OGRGeometry *OGRWKBCreateGeometryFast(const GByte *pabyWkb, size_t nWKBSize)
+{
+    if (nWKBSize < 9 || pabyWkb[0] > wkbNDR ||
+        OGR_SWAP(static_cast<OGRwkbByteOrder>(pabyWkb[0])))
+        return nullptr;
+    uint32_t nType = 0;
+    memcpy(&nType, pabyWkb + 1, sizeof(nType));
+    switch (nType)
+    {
+        case wkbPoint:
+        case wkbPoint + 1000:  // ISO Z
+        case wkbPoint + 2000:  // ISO M
+        case wkbPoint + 3000:  // ISO ZM
+        {
+            const bool bHasZ =
+                (nType == wkbPoint + 1000 || nType == wkbPoint + 3000);
+            const bool bHasM = (nType >= wkbPoint + 2000);
+            const int nCoords = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+            if (nWKBSize < static_cast<size_t>(5 + 8 * nCoords))
+                return nullptr;
+            double adfCoords[4];
+            memcpy(adfCoords, pabyWkb + 5, 8 * nCoords);
+            if (CPLIsNan(adfCoords[0]))
+            {
+                // POINT EMPTY: keep the generic parser's handling
+                return nullptr;
+            }
+            if (bHasZ && bHasM)
+                return new OGRPoint(adfCoords[0], adfCoords[1], adfCoords[2],
+                                    adfCoords[3]);
+            if (bHasZ)
+                return new OGRPoint(adfCoords[0], adfCoords[1], adfCoords[2]);
+            if (bHasM)
+                return OGRPoint::createXYM(adfCoords[0], adfCoords[1],
+                                           adfCoords[2]);
+            return new OGRPoint(adfCoords[0], adfCoords[1]);
+        }
+
+        case wkbLineString:
+        {
+            uint32_t nPoints = 0;
+            memcpy(&nPoints, pabyWkb + 5, sizeof(nPoints));
+            if (nPoints > (nWKBSize - 9) / 16)
+                return nullptr;
+            auto poLS = new OGRLineString();
+            if (nPoints)
+            {
+                // setPoints() copies with memcpy, so the potentially
+                // unaligned source pointer is fine.
+                poLS->setPoints(
+                    static_cast<int>(nPoints),
+                    reinterpret_cast<const OGRRawPoint *>(pabyWkb + 9));
+            }
+            return poLS;
+        }
+
+        case wkbPolygon:
+        {
+            uint32_t nRings = 0;
+            memcpy(&nRings, pabyWkb + 5, sizeof(nRings));
+            auto poPoly = new OGRPolygon();
+            // Each ring takes at least 4 bytes, which bounds nRings for
+            // valid input, and keeps the reservation small on corrupt one
+            if (nRings <= (nWKBSize - 9) / 4)
+                poPoly->reserveRings(static_cast<int>(nRings));
+            size_t nOffset = 9;
+            for (uint32_t iRing = 0; iRing < nRings; ++iRing)
+            {
+                uint32_t nPoints = 0;
+                if (nOffset + 4 > nWKBSize)
+                {
+                    delete poPoly;
+                    return nullptr;
+                }
+                memcpy(&nPoints, pabyWkb + nOffset, sizeof(nPoints));
+                nOffset += 4;
+                if (nPoints > (nWKBSize - nOffset) / 16)
+                {
+                    delete poPoly;
+                    return nullptr;
+                }
+                auto poRing = new OGRLinearRing();
+                if (nPoints)
+                {
+                    poRing->setPoints(
+                        static_cast<int>(nPoints),
+                        reinterpret_cast<const OGRRawPoint *>(pabyWkb +
+                                                              nOffset));
+                }
+                poPoly->addRingDirectly(poRing);
+                nOffset += static_cast<size_t>(nPoints) * 16;
+            }
+            return poPoly;
+        }
+
+        default:
+            // Includes the EWKB dimensionality flags and all compound
+            // types: the generic parser deals with them.
+            return nullptr;
+    }
+}
+
+/************************************************************************/
+/*                   OGRWKBPointGetBoundingBoxFast()                    */
+/************************************************************************/
+
+bool OGRWKBPointGetBoundingBoxFast(const GByte *pabyWkb, size_t nWKBSize,
+                                   OGREnvelope &sEnvelope)
+{
+    if (nWKBSize != 21 || pabyWkb[0] > wkbNDR ||
+        OGR_SWAP(static_cast<OGRwkbByteOrder>(pabyWkb[0])))
+        return false;
+    uint32_t nType = 0;
+    memcpy(&nType, pabyWkb + 1, sizeof(nType));
+    if (nType != wkbPoint)
+        return false;
+    double dfX = 0;
+    double dfY = 0;
+    memcpy(&dfX, pabyWkb + 5, sizeof(double));
+    memcpy(&dfY, pabyWkb + 13, sizeof(double));
+    if (CPLIsNan(dfX))
+    {
+        // POINT EMPTY: keep the generic handling
+        return false;
+    }
+    sEnvelope.MinX = dfX;
+    sEnvelope.MinY = dfY;
+    sEnvelope.MaxX = dfX;
+    sEnvelope.MaxY = dfY;
+    return true;
+}
+
 /************************************************************************/
 /*              OGRWKBIntersectsPointSequencePessimistic()              */
 /************************************************************************/
@@ -32,6 +32,8 @@
 #include "cpl_port.h"
 #include "ogr_core.h"
 
+class OGRGeometry;
+
 bool CPL_DLL OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize,
                                bool &bNeedSwap, uint32_t &nType);
 bool OGRWKBPolygonGetArea(const GByte *&pabyWkb, size_t &nWKBSize,
@@ -42,6 +44,22 @@ bool OGRWKBMultiPolygonGetArea(const GByte *&pabyWkb, size_t &nWKBSize,
 bool CPL_DLL OGRWKBGetBoundingBox(const GByte *pabyWkb, size_t nWKBSize,
                                   OGREnvelope &sEnvelope);
 
+/** Fast path of OGRGeometryFactory::createFromWkb() for the common simple
+ * shapes (point, 2D line string, 2D polygon) in native byte order.
+ * Returns nullptr when the input is not one of the handled shapes (or is
+ * corrupt), in which case the caller must fall back to the generic parser.
+ */
+OGRGeometry CPL_DLL *OGRWKBCreateGeometryFast(const GByte *pabyWkb,
+                                              size_t nWKBSize);
+
+/** Fast path of OGRWKBGetBoundingBox() for the dominant case of a native
+ * byte order 2D point. Returns false for anything else, in which case the
+ * generic implementation must be used.
+ */
+bool CPL_DLL OGRWKBPointGetBoundingBoxFast(const GByte *pabyWkb,
+                                           size_t nWKBSize,
+                                           OGREnvelope &sEnvelope);
+
 bool CPL_DLL OGRWKBIntersectsPessimistic(const GByte *pabyWkb, size_t nWKBSize,
                                          const OGREnvelope &sEnvelope);
 
@@ -72,6 +72,7 @@ OGRCurveCollection::OGRCurveCollection(const OGRCurveCollection &other)
 
         if (papoCurves)
         {
+            nCurveCapacity = nCurveCount;
             for (int i = 0; i < nCurveCount; i++)
             {
                 papoCurves[i] = other.papoCurves[i]->clone();
@@ -118,6 +119,7 @@ OGRCurveCollection::operator=(const OGRCurveCollection &other)
 
             if (papoCurves)
             {
+                nCurveCapacity = nCurveCount;
                 for (int i = 0; i < nCurveCount; i++)
                 {
                     papoCurves[i] = other.papoCurves[i]->clone();
@@ -153,13 +155,14 @@ OGRErr OGRCurveCollection::addCurveDirectly(OGRGeometry *poGeom,
 {
     poGeom->HomogenizeDimensionalityWith(poCurve);
 
-    if (bNeedRealloc)
+    if (bNeedRealloc && nCurveCount >= nCurveCapacity)
     {
         OGRCurve **papoNewCurves = static_cast<OGRCurve **>(VSI_REALLOC_VERBOSE(
             papoCurves, sizeof(OGRCurve *) * (nCurveCount + 1)));
         if (papoNewCurves == nullptr)
             return OGRERR_FAILURE;
         papoCurves = papoNewCurves;
+        nCurveCapacity = nCurveCount + 1;
     }
 
     papoCurves[nCurveCount] = poCurve;
@@ -169,6 +172,26 @@ OGRErr OGRCurveCollection::addCurveDirectly(OGRGeometry *poGeom,
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                              reserve()                               */
+/************************************************************************/
+
+OGRErr OGRCurveCollection::reserve(int nCurveCountIn)
+{
+    if (nCurveCountIn <= nCurveCapacity)
+        return OGRERR_NONE;
+
+    OGRCurve **papoNewCurves = static_cast<OGRCurve **>(
+        VSI_REALLOC_VERBOSE(papoCurves, sizeof(OGRCurve *) * nCurveCountIn));
+    if (papoNewCurves == nullptr)
+        return OGRERR_FAILURE;
+
+    papoCurves = papoNewCurves;
+    nCurveCapacity = nCurveCountIn;
+
+    return OGRERR_NONE;
+}
+
 /************************************************************************/
 /*                        importPreambleFromWkb()                      */
 /************************************************************************/
@@ -192,6 +215,7 @@ OGRErr OGRCurveCollection::importPreambleFromWkb(
         nCurveCount = 0;
         return OGRERR_NOT_ENOUGH_MEMORY;
     }
+    nCurveCapacity = nCurveCount;
 
     return OGRERR_NONE;
 }
@@ -426,6 +450,7 @@ void OGRCurveCollection::empty(OGRGeometry *poGeom)
     }
 
     nCurveCount = 0;
+    nCurveCapacity = 0;
     papoCurves = nullptr;
     if (poGeom)
         poGeom->setCoordinateDimension(2);
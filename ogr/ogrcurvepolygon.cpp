@@ -455,6 +455,30 @@ OGRErr OGRCurvePolygon::addRing(std::unique_ptr<OGRCurve> poNewRing)
     return eErr;
 }
 
+/************************************************************************/
+/*                           reserveRings()                             */
+/************************************************************************/
+
+/**
+ * \brief Pre-allocate room for at least nRingCount rings.
+ *
+ * To be used when the number of rings that will be added through addRing()
+ * / addRingDirectly() is known in advance, to avoid repeated reallocations
+ * of the internal ring array.
+ *
+ * @param nRingCount number of rings that the polygon should be able to
+ * hold without further reallocation.
+ *
+ * @return OGRERR_NONE if successful, or OGRERR_FAILURE in case of memory
+ * allocation failure.
+ *
+ * @since GDAL 3.8
+ */
+OGRErr OGRCurvePolygon::reserveRings(int nRingCount)
+{
+    return oCC.reserve(nRingCount);
+}
+
 /************************************************************************/
 /*                              WkbSize()                               */
 /*                                                                      */
@@ -863,8 +887,10 @@ OGRPolygon *OGRCurvePolygon::CastToPolygon(OGRCurvePolygon *poCP)
     poPoly->setCoordinateDimension(poCP->getCoordinateDimension());
     poPoly->assignSpatialReference(poCP->getSpatialReference());
     poPoly->oCC.nCurveCount = poCP->oCC.nCurveCount;
+    poPoly->oCC.nCurveCapacity = poCP->oCC.nCurveCapacity;
     poPoly->oCC.papoCurves = poCP->oCC.papoCurves;
     poCP->oCC.nCurveCount = 0;
+    poCP->oCC.nCurveCapacity = 0;
     poCP->oCC.papoCurves = nullptr;
     delete poCP;
     return poPoly;
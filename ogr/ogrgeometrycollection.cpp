@@ -75,6 +75,7 @@ OGRGeometryCollection::OGRGeometryCollection(const OGRGeometryCollection &other)
     if (papoGeoms)
     {
         nGeomCount = other.nGeomCount;
+        nGeomCapacity = other.nGeomCount;
         for (int i = 0; i < other.nGeomCount; i++)
         {
             papoGeoms[i] = other.papoGeoms[i]->clone();
@@ -139,6 +140,7 @@ void OGRGeometryCollection::empty()
     }
 
     nGeomCount = 0;
+    nGeomCapacity = 0;
     papoGeoms = nullptr;
 }
 
@@ -363,12 +365,16 @@ OGRErr OGRGeometryCollection::addGeometryDirectly(OGRGeometry *poNewGeom)
 
     HomogenizeDimensionalityWith(poNewGeom);
 
-    OGRGeometry **papoNewGeoms = static_cast<OGRGeometry **>(
-        VSI_REALLOC_VERBOSE(papoGeoms, sizeof(void *) * (nGeomCount + 1)));
-    if (papoNewGeoms == nullptr)
-        return OGRERR_FAILURE;
+    if (nGeomCount >= nGeomCapacity)
+    {
+        OGRGeometry **papoNewGeoms = static_cast<OGRGeometry **>(
+            VSI_REALLOC_VERBOSE(papoGeoms, sizeof(void *) * (nGeomCount + 1)));
+        if (papoNewGeoms == nullptr)
+            return OGRERR_FAILURE;
 
-    papoGeoms = papoNewGeoms;
+        papoGeoms = papoNewGeoms;
+        nGeomCapacity = nGeomCount + 1;
+    }
     papoGeoms[nGeomCount] = poNewGeom;
 
     nGeomCount++;
@@ -403,6 +409,42 @@ OGRErr OGRGeometryCollection::addGeometry(std::unique_ptr<OGRGeometry> geom)
     return eErr;
 }
 
+/************************************************************************/
+/*                              reserve()                               */
+/************************************************************************/
+
+/**
+ * \brief Pre-allocate room for at least nGeomCountIn geometries.
+ *
+ * To be used when the number of geometries that will be added through
+ * addGeometry() / addGeometryDirectly() is known in advance, to avoid
+ * repeated reallocations of the internal geometry array.
+ *
+ * @param nGeomCountIn number of geometries that the container should be
+ * able to hold without further reallocation.
+ *
+ * @return OGRERR_NONE if successful, or OGRERR_FAILURE in case of memory
+ * allocation failure.
+ *
+ * @since GDAL 3.8
+ */
+
+OGRErr OGRGeometryCollection::reserve(int nGeomCountIn)
+{
+    if (nGeomCountIn <= nGeomCapacity)
+        return OGRERR_NONE;
+
+    OGRGeometry **papoNewGeoms = static_cast<OGRGeometry **>(
+        VSI_REALLOC_VERBOSE(papoGeoms, sizeof(void *) * nGeomCountIn));
+    if (papoNewGeoms == nullptr)
+        return OGRERR_FAILURE;
+
+    papoGeoms = papoNewGeoms;
+    nGeomCapacity = nGeomCountIn;
+
+    return OGRERR_NONE;
+}
+
 /************************************************************************/
 /*                           removeGeometry()                           */
 /************************************************************************/
@@ -510,6 +552,7 @@ OGRErr OGRGeometryCollection::importFromWkbInternal(
         nGeomCount = 0;
         return OGRERR_NOT_ENOUGH_MEMORY;
     }
+    nGeomCapacity = nGeomCount;
 
     /* -------------------------------------------------------------------- */
     /*      Get the Geoms.                                                  */
@@ -1289,8 +1332,10 @@ OGRGeometryCollection::TransferMembersAndDestroy(OGRGeometryCollection *poSrc,
     poDst->set3D(poSrc->Is3D());
     poDst->setMeasured(poSrc->IsMeasured());
     poDst->nGeomCount = poSrc->nGeomCount;
+    poDst->nGeomCapacity = poSrc->nGeomCapacity;
     poDst->papoGeoms = poSrc->papoGeoms;
     poSrc->nGeomCount = 0;
+    poSrc->nGeomCapacity = 0;
     poSrc->papoGeoms = nullptr;
     delete poSrc;
     return poDst;
@@ -258,6 +258,7 @@ OGRErr OGRMultiPolygon::_addGeometryDirectlyWithExpectedSubGeometryType(
         return OGRERR_FAILURE;
 
     papoGeoms = papoNewGeoms;
+    nGeomCapacity = nGeomCount + 1;
     papoGeoms[nGeomCount] = poNewGeom;
     nGeomCount++;
 
@@ -577,6 +577,7 @@ OGRErr OGRPolygon::importFromWKTListOnly(const char **ppszInput, int bHasZ,
                 nMaxRings = nMaxRings * 2 + 1;
                 oCC.papoCurves = static_cast<OGRCurve **>(CPLRealloc(
                     oCC.papoCurves, nMaxRings * sizeof(OGRLinearRing *)));
+                oCC.nCurveCapacity = nMaxRings;
             }
             oCC.papoCurves[oCC.nCurveCount] = new OGRLinearRing();
             oCC.nCurveCount++;
@@ -632,6 +633,7 @@ OGRErr OGRPolygon::importFromWKTListOnly(const char **ppszInput, int bHasZ,
             nMaxRings = nMaxRings * 2 + 1;
             oCC.papoCurves = static_cast<OGRCurve **>(CPLRealloc(
                 oCC.papoCurves, nMaxRings * sizeof(OGRLinearRing *)));
+            oCC.nCurveCapacity = nMaxRings;
         }
 
         /* --------------------------------------------------------------------
@@ -871,8 +873,10 @@ OGRCurvePolygon *OGRPolygon::CastToCurvePolygon(OGRPolygon *poPoly)
     poCP->setMeasured(poPoly->IsMeasured());
     poCP->assignSpatialReference(poPoly->getSpatialReference());
     poCP->oCC.nCurveCount = poPoly->oCC.nCurveCount;
+    poCP->oCC.nCurveCapacity = poPoly->oCC.nCurveCapacity;
     poCP->oCC.papoCurves = poPoly->oCC.papoCurves;
     poPoly->oCC.nCurveCount = 0;
+    poPoly->oCC.nCurveCapacity = 0;
     poPoly->oCC.papoCurves = nullptr;
 
     for (auto &&poRing : *poCP)
@@ -167,6 +167,7 @@ void OGRPolyhedralSurface::empty()
         CPLFree(oMP.papoGeoms);
     }
     oMP.nGeomCount = 0;
+    oMP.nGeomCapacity = 0;
     oMP.papoGeoms = nullptr;
 }
 
@@ -215,6 +216,7 @@ OGRErr OGRPolyhedralSurface::importFromWkb(const unsigned char *pabyData,
         oMP.nGeomCount = 0;
         return OGRERR_NOT_ENOUGH_MEMORY;
     }
+    oMP.nGeomCapacity = oMP.nGeomCount;
 
     /* -------------------------------------------------------------------- */
     /*      Get the Geoms.                                                  */
@@ -779,6 +781,7 @@ OGRErr OGRPolyhedralSurface::addGeometryDirectly(OGRGeometry *poNewGeom)
         return OGRERR_FAILURE;
 
     oMP.papoGeoms = papoNewGeoms;
+    oMP.nGeomCapacity = oMP.nGeomCount + 1;
     oMP.papoGeoms[oMP.nGeomCount] = poNewGeom;
     oMP.nGeomCount++;
 
@@ -165,6 +165,13 @@ void OGRFeatherLayer::EstablishFeatureDefn()
         LoadGDALMetadata(kv_metadata.get());
 
     const auto fields = m_poSchema->fields();
+    // Upper bound: struct fields can expand to more entries, but this
+    // avoids reallocations for the common flat-schema case.
+    m_anMapFieldIndexToArrowColumn.reserve(fields.size());
+    m_poFeatureDefn->ReserveSpaceForFields(static_cast<int>(fields.size()));
+    // Scratch path vector reused across fields to avoid per-field
+    // allocations; CreateFieldFromSchema() mutates and restores it.
+    std::vector<int> anPath;
     for (int i = 0; i < m_poSchema->num_fields(); ++i)
     {
         const auto &field = fields[i];
@@ -270,7 +277,9 @@ void OGRFeatherLayer::EstablishFeatureDefn()
 
         if (bRegularField)
         {
-            CreateFieldFromSchema(field, {i},
+            anPath.clear();
+            anPath.push_back(i);
+            CreateFieldFromSchema(field, anPath,
                                   oMapFieldNameToGDALSchemaFieldDefn);
         }
     }
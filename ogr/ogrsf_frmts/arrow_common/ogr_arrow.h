@@ -73,9 +73,22 @@ class OGRArrowLayer CPL_NON_FINAL
         int iField = -1;      // index to a OGRFeatureDefn OGRField
         int iArrayIdx = -1;   // index to m_poBatchColumns
         int nOperation = -1;  // SWQ_xxxx
+        // Whether the column has nulls in the current batch. Refreshed
+        // by SetBatch()
+        bool bHasNulls = false;
         Type eType{};
         OGRField sValue{};
         std::string osValue{};
+
+        // Per-column-type row evaluator, resolved from the column type
+        // on first use (the type of a field's column does not change
+        // during a scan). Returns false when the row must be skipped.
+        typedef bool (*RowEvaluatorType)(const Constraint &,
+                                         const arrow::Array *, int64_t);
+        mutable RowEvaluatorType pfnRowEvaluator = nullptr;
+        // Scale of the column, when it is of a decimal type. Resolved
+        // together with pfnRowEvaluator.
+        mutable int32_t nDecimalScale = 0;
     };
 
   private:
@@ -85,13 +98,35 @@ class OGRArrowLayer CPL_NON_FINAL
     int m_nUseOptimizedAttributeFilter = -1;
     bool m_bSpatialFilterIntersectsLayerExtent = true;
     bool m_bUseRecordBatchBaseImplementation = false;
+    // Whether the GEOMETRY_ENCODING=WKB stream option has been
+    // requested and at least one geometry column is WKT-encoded, i.e.
+    // whether GetNextArrowArray() must convert geometry columns.
+    // Set by GetArrowStream()
+    bool m_bConvertWKTToWKB = false;
+
+    // Cached GetDriverUCName() result, and per-layer cache of the
+    // OGR_{DRIVER}_USE_BBOX config option, to avoid re-evaluating them on
+    // hot paths (e.g. for each batch)
+    mutable std::string m_osCachedDriverUCName{};
+    mutable int m_nUseBBOX = -1;
+    typedef void (*ArrowFieldReaderType)(OGRFeature *, int, int64_t,
+                                         const arrow::Array *);
+    // Cached per-OGR-field readers, resolved from the (static) column
+    // type on first use. Indexed by OGR field index.
+    mutable std::vector<ArrowFieldReaderType> m_apfnFieldReaders{};
 
     // Modified by UseRecordBatchBaseImplementation()
     mutable struct ArrowSchema m_sCachedSchema = {};
 
+    // Cached ComputeUseRecordBatchBaseImplementation() result.
+    // Invalidated (reset to -1) when the filters, the ignored fields or
+    // the Arrow stream options change.
+    mutable int m_nCachedUseRecordBatchBaseImpl = -1;
+
     bool SkipToNextFeatureDueToAttributeFilter() const;
     void ExploreExprNode(const swq_expr_node *poNode);
     bool UseRecordBatchBaseImplementation() const;
+    bool ComputeUseRecordBatchBaseImplementation() const;
 
     template <typename SourceOffset>
     static struct ArrowArray *
@@ -123,6 +158,10 @@ class OGRArrowLayer CPL_NON_FINAL
     const arrow::DoubleArray *m_poArrayMinY = nullptr;
     const arrow::DoubleArray *m_poArrayMaxX = nullptr;
     const arrow::DoubleArray *m_poArrayMaxY = nullptr;
+    // Whether the above arrays may contain nulls in the current batch.
+    // Refreshed by SetBatch()
+    bool m_bArrayWKBMayBeNull = false;
+    bool m_bArrayBBOXMayBeNull = false;
 
     bool m_bIgnoredFields = false;
     std::vector<int>
@@ -143,7 +182,9 @@ class OGRArrowLayer CPL_NON_FINAL
     // result
     std::vector<std::shared_ptr<arrow::Array>>
         m_poBatchColumns{};  // must always be == m_poBatch->columns()
-    mutable std::shared_ptr<arrow::Array> m_poReadFeatureTmpArray{};
+    // Scratch NUL-terminated copy of WKT cells, reusing its capacity
+    // across rows
+    mutable std::string m_osWKTScratch{};
 
     std::vector<Constraint> m_asAttributeFilterConstraints{};
 
@@ -153,7 +194,9 @@ class OGRArrowLayer CPL_NON_FINAL
     OGRArrowLayer(OGRArrowDataset *poDS, const char *pszLayerName);
 
     virtual std::string GetDriverUCName() const = 0;
-    static bool IsIntegerArrowType(arrow::Type::type typeId);
+    const std::string &GetDriverUCNameCached() const;
+    bool UseBBOX() const;
+    static constexpr bool IsIntegerArrowType(arrow::Type::type typeId);
     static bool
     IsHandledListOrMapType(const std::shared_ptr<arrow::DataType> &valueType);
     static bool
@@ -175,8 +218,7 @@ class OGRArrowLayer CPL_NON_FINAL
                       const std::map<std::string, std::unique_ptr<OGRFieldDefn>>
                           &oMapFieldNameToGDALSchemaFieldDefn);
     void CreateFieldFromSchema(
-        const std::shared_ptr<arrow::Field> &field,
-        const std::vector<int> &path,
+        const std::shared_ptr<arrow::Field> &field, std::vector<int> &path,
         const std::map<std::string, std::unique_ptr<OGRFieldDefn>>
             &oMapFieldNameToGDALSchemaFieldDefn);
     std::unique_ptr<OGRFieldDomain>
@@ -188,6 +230,12 @@ class OGRArrowLayer CPL_NON_FINAL
         int iBatchCol, OGRwkbGeometryType eGeomType) const;
     static bool ReadWKBBoundingBox(const uint8_t *data, size_t size,
                                    OGREnvelope &sEnvelope);
+    // Materialize one row of the current batch as an OGRFeature. This is
+    // deliberately row-major: OGRLayer hands features out one at a time,
+    // so a column-major fill would have to materialize all the features
+    // of a batch up front. Consumers that want columnar access should go
+    // through GetArrowStream() / GetNextArrowArray() instead, which pass
+    // the record batches through without per-row materialization.
     OGRFeature *ReadFeature(
         int64_t nIdxInBatch,
         const std::vector<std::shared_ptr<arrow::Array>> &poColumnArrays) const;
@@ -207,6 +255,9 @@ class OGRArrowLayer CPL_NON_FINAL
     // Refreshes Constraint.iArrayIdx from iField. To be called by SetIgnoredFields()
     void ComputeConstraintsArrayIdx();
 
+    // Refreshes Constraint.bHasNulls from the current batch columns
+    void RefreshConstraintsNullness();
+
     virtual bool FastGetExtent(int iGeomField, OGREnvelope *psExtent) const;
     static OGRErr GetExtentFromMetadata(const CPLJSONObject &oJSONDef,
                                         OGREnvelope *psExtent);
@@ -240,6 +291,8 @@ class OGRArrowLayer CPL_NON_FINAL
     }
     void SetSpatialFilter(int iGeomField, OGRGeometry *poGeom) override;
 
+    OGRErr SetIgnoredFields(const char **papszFields) override;
+
     int TestCapability(const char *pszCap) override;
 
     bool GetArrowStream(struct ArrowArrayStream *out_stream,
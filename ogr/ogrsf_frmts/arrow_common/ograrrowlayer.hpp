@@ -30,7 +30,7 @@
 
 #include "cpl_float.h"
 #include "cpl_json.h"
-#include "cpl_time.h"
+#include "cpl_json_streaming_writer.h"
 #include "ogrlayerarrow.h"
 #include "ogr_p.h"
 #include "ogr_swq.h"
@@ -39,6 +39,7 @@
 #include <algorithm>
 #include <cinttypes>
 #include <limits>
+#include <unordered_map>
 
 #define SWQ_ISNOTNULL (-SWQ_ISNULL)
 
@@ -72,6 +73,81 @@ inline OGRArrowLayer::~OGRArrowLayer()
     m_poFeatureDefn->Release();
 }
 
+/************************************************************************/
+/*                      GetDriverUCNameCached()                         */
+/************************************************************************/
+
+inline const std::string &OGRArrowLayer::GetDriverUCNameCached() const
+{
+    if (m_osCachedDriverUCName.empty())
+        m_osCachedDriverUCName = GetDriverUCName();
+    return m_osCachedDriverUCName;
+}
+
+/************************************************************************/
+/*                              UseBBOX()                               */
+/************************************************************************/
+
+inline bool OGRArrowLayer::UseBBOX() const
+{
+    if (m_nUseBBOX < 0)
+    {
+        m_nUseBBOX = CPLTestBool(CPLGetConfigOption(
+            ("OGR_" + GetDriverUCNameCached() + "_USE_BBOX").c_str(), "YES"));
+    }
+    return m_nUseBBOX != 0;
+}
+
+/************************************************************************/
+/*                       GetMapFieldTypeByName()                        */
+/************************************************************************/
+
+// Map from lowercased field type name to enum value, so that
+// LoadGDALMetadata() does a single hash probe per column instead of
+// iterating over all enum values with EQUAL().
+static const std::unordered_map<std::string, OGRFieldType> &
+GetMapFieldTypeByName()
+{
+    static const auto oMap = []()
+    {
+        std::unordered_map<std::string, OGRFieldType> oTmpMap;
+        oTmpMap.reserve(static_cast<int>(OFTMaxType) + 1);
+        for (int iType = 0; iType <= static_cast<int>(OFTMaxType); iType++)
+        {
+            CPLString osName(OGRFieldDefn::GetFieldTypeName(
+                static_cast<OGRFieldType>(iType)));
+            osName.tolower();
+            oTmpMap[osName] = static_cast<OGRFieldType>(iType);
+        }
+        return oTmpMap;
+    }();
+    return oMap;
+}
+
+/************************************************************************/
+/*                     GetMapFieldSubTypeByName()                       */
+/************************************************************************/
+
+static const std::unordered_map<std::string, OGRFieldSubType> &
+GetMapFieldSubTypeByName()
+{
+    static const auto oMap = []()
+    {
+        std::unordered_map<std::string, OGRFieldSubType> oTmpMap;
+        oTmpMap.reserve(static_cast<int>(OFSTMaxSubType) + 1);
+        for (int iSubType = 0; iSubType <= static_cast<int>(OFSTMaxSubType);
+             iSubType++)
+        {
+            CPLString osName(OGRFieldDefn::GetFieldSubTypeName(
+                static_cast<OGRFieldSubType>(iSubType)));
+            osName.tolower();
+            oTmpMap[osName] = static_cast<OGRFieldSubType>(iSubType);
+        }
+        return oTmpMap;
+    }();
+    return oMap;
+}
+
 /************************************************************************/
 /*                         LoadGDALMetadata()                           */
 /************************************************************************/
@@ -81,78 +157,91 @@ OGRArrowLayer::LoadGDALMetadata(const arrow::KeyValueMetadata *kv_metadata)
 {
     std::map<std::string, std::unique_ptr<OGRFieldDefn>>
         oMapFieldNameToGDALSchemaFieldDefn;
-    if (kv_metadata && kv_metadata->Contains("gdal:schema") &&
-        CPLTestBool(CPLGetConfigOption(
-            ("OGR_" + GetDriverUCName() + "_READ_GDAL_SCHEMA").c_str(), "YES")))
+    // Test for the presence of the metadata key first: it is cheap and,
+    // when absent, avoids building the config option name.
+    if (!kv_metadata || !kv_metadata->Contains("gdal:schema"))
+        return oMapFieldNameToGDALSchemaFieldDefn;
+    if (!CPLTestBool(CPLGetConfigOption(
+            ("OGR_" + GetDriverUCNameCached() + "_READ_GDAL_SCHEMA").c_str(),
+            "YES")))
+        return oMapFieldNameToGDALSchemaFieldDefn;
+    auto gdalSchema = kv_metadata->Get("gdal:schema");
+    if (gdalSchema.ok())
     {
-        auto gdalSchema = kv_metadata->Get("gdal:schema");
-        if (gdalSchema.ok())
+        CPLDebug(GetDriverUCNameCached().c_str(), "gdal:schema = %s",
+                 gdalSchema->c_str());
+        CPLJSONDocument oDoc;
+        if (oDoc.LoadMemory(*gdalSchema))
         {
-            CPLDebug(GetDriverUCName().c_str(), "gdal:schema = %s",
-                     gdalSchema->c_str());
-            CPLJSONDocument oDoc;
-            if (oDoc.LoadMemory(*gdalSchema))
-            {
-                auto oRoot = oDoc.GetRoot();
+            auto oRoot = oDoc.GetRoot();
 
-                m_osFIDColumn = oRoot.GetString("fid");
+            m_osFIDColumn = oRoot.GetString("fid");
 
-                auto oColumns = oRoot.GetObj("columns");
-                if (oColumns.IsValid())
+            auto oColumns = oRoot.GetObj("columns");
+            if (oColumns.IsValid())
+            {
+                for (const auto &oColumn : oColumns.GetChildren())
                 {
-                    for (const auto &oColumn : oColumns.GetChildren())
+                    const auto osName = oColumn.GetName();
+                    // Fetch all attributes in a single pass over the
+                    // column members, as each GetString()/GetInteger()
+                    // does its own lookup in the JSON object.
+                    std::string osType;
+                    std::string osSubType;
+                    std::string osAlternativeName;
+                    std::string osComment;
+                    int nWidth = 0;
+                    int nPrecision = 0;
+                    for (const auto &oAttr : oColumn.GetChildren())
                     {
-                        const auto osName = oColumn.GetName();
-                        const auto osType = oColumn.GetString("type");
-                        const auto osSubType = oColumn.GetString("subtype");
-                        auto poFieldDefn = cpl::make_unique<OGRFieldDefn>(
-                            osName.c_str(), OFTString);
-                        for (int iType = 0;
-                             iType <= static_cast<int>(OFTMaxType); iType++)
-                        {
-                            if (EQUAL(osType.c_str(),
-                                      OGRFieldDefn::GetFieldTypeName(
-                                          static_cast<OGRFieldType>(iType))))
-                            {
-                                poFieldDefn->SetType(
-                                    static_cast<OGRFieldType>(iType));
-                                break;
-                            }
-                        }
-                        if (!osSubType.empty())
-                        {
-                            for (int iSubType = 0;
-                                 iSubType <= static_cast<int>(OFSTMaxSubType);
-                                 iSubType++)
-                            {
-                                if (EQUAL(osSubType.c_str(),
-                                          OGRFieldDefn::GetFieldSubTypeName(
-                                              static_cast<OGRFieldSubType>(
-                                                  iSubType))))
-                                {
-                                    poFieldDefn->SetSubType(
-                                        static_cast<OGRFieldSubType>(iSubType));
-                                    break;
-                                }
-                            }
-                        }
-                        poFieldDefn->SetWidth(oColumn.GetInteger("width"));
-                        poFieldDefn->SetPrecision(
-                            oColumn.GetInteger("precision"));
-
-                        const auto osAlternativeName =
-                            oColumn.GetString("alternative_name");
-                        if (!osAlternativeName.empty())
-                            poFieldDefn->SetAlternativeName(
-                                osAlternativeName.c_str());
-
-                        const auto osComment = oColumn.GetString("comment");
-                        if (!osComment.empty())
-                            poFieldDefn->SetComment(osComment);
-
-                        oMapFieldNameToGDALSchemaFieldDefn[osName] =
-                            std::move(poFieldDefn);
+                        const auto osAttrName = oAttr.GetName();
+                        if (osAttrName == "type")
+                            osType = oAttr.ToString();
+                        else if (osAttrName == "subtype")
+                            osSubType = oAttr.ToString();
+                        else if (osAttrName == "width")
+                            nWidth = oAttr.ToInteger();
+                        else if (osAttrName == "precision")
+                            nPrecision = oAttr.ToInteger();
+                        else if (osAttrName == "alternative_name")
+                            osAlternativeName = oAttr.ToString();
+                        else if (osAttrName == "comment")
+                            osComment = oAttr.ToString();
+                    }
+                    auto poFieldDefn = cpl::make_unique<OGRFieldDefn>(
+                        osName.c_str(), OFTString);
+                    {
+                        CPLString osTypeLower(osType);
+                        osTypeLower.tolower();
+                        const auto &oMapType = GetMapFieldTypeByName();
+                        const auto oIterType =
+                            oMapType.find(osTypeLower);
+                        if (oIterType != oMapType.end())
+                            poFieldDefn->SetType(oIterType->second);
+                    }
+                    if (!osSubType.empty())
+                    {
+                        CPLString osSubTypeLower(osSubType);
+                        osSubTypeLower.tolower();
+                        const auto &oMapSubType =
+                            GetMapFieldSubTypeByName();
+                        const auto oIterSubType =
+                            oMapSubType.find(osSubTypeLower);
+                        if (oIterSubType != oMapSubType.end())
+                            poFieldDefn->SetSubType(oIterSubType->second);
                     }
+                    poFieldDefn->SetWidth(nWidth);
+                    poFieldDefn->SetPrecision(nPrecision);
+
+                    if (!osAlternativeName.empty())
+                        poFieldDefn->SetAlternativeName(
+                            osAlternativeName.c_str());
+
+                    if (!osComment.empty())
+                        poFieldDefn->SetComment(osComment);
+
+                    oMapFieldNameToGDALSchemaFieldDefn[osName] =
+                        std::move(poFieldDefn);
                 }
             }
         }
@@ -164,7 +253,7 @@ OGRArrowLayer::LoadGDALMetadata(const arrow::KeyValueMetadata *kv_metadata)
 /*                        IsIntegerArrowType()                          */
 /************************************************************************/
 
-inline bool OGRArrowLayer::IsIntegerArrowType(arrow::Type::type typeId)
+constexpr bool OGRArrowLayer::IsIntegerArrowType(arrow::Type::type typeId)
 {
     return typeId == arrow::Type::INT8 || typeId == arrow::Type::UINT8 ||
            typeId == arrow::Type::INT16 || typeId == arrow::Type::UINT16 ||
@@ -172,6 +261,41 @@ inline bool OGRArrowLayer::IsIntegerArrowType(arrow::Type::type typeId)
            typeId == arrow::Type::INT64 || typeId == arrow::Type::UINT64;
 }
 
+/************************************************************************/
+/*                          IsHandledLeafType()                         */
+/************************************************************************/
+
+// Primitive leaf types that the generic JSON serialization of lists and
+// maps knows how to handle. The switch compiles down to a simple bitmask
+// test on the type id.
+static bool IsHandledLeafType(arrow::Type::type itemTypeId)
+{
+    switch (itemTypeId)
+    {
+        case arrow::Type::BOOL:
+        case arrow::Type::UINT8:
+        case arrow::Type::INT8:
+        case arrow::Type::UINT16:
+        case arrow::Type::INT16:
+        case arrow::Type::UINT32:
+        case arrow::Type::INT32:
+        case arrow::Type::UINT64:
+        case arrow::Type::INT64:
+        case arrow::Type::HALF_FLOAT:
+        case arrow::Type::FLOAT:
+        case arrow::Type::DOUBLE:
+        case arrow::Type::DECIMAL128:
+        case arrow::Type::DECIMAL256:
+        case arrow::Type::STRING:
+        case arrow::Type::LARGE_STRING:
+        case arrow::Type::STRUCT:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
 /************************************************************************/
 /*                         IsHandledListOrMapType()                     */
 /************************************************************************/
@@ -179,24 +303,33 @@ inline bool OGRArrowLayer::IsIntegerArrowType(arrow::Type::type typeId)
 inline bool OGRArrowLayer::IsHandledListOrMapType(
     const std::shared_ptr<arrow::DataType> &valueType)
 {
-    const auto itemTypeId = valueType->id();
-    return itemTypeId == arrow::Type::BOOL || IsIntegerArrowType(itemTypeId) ||
-           itemTypeId == arrow::Type::HALF_FLOAT ||
-           itemTypeId == arrow::Type::FLOAT ||
-           itemTypeId == arrow::Type::DOUBLE ||
-           itemTypeId == arrow::Type::DECIMAL128 ||
-           itemTypeId == arrow::Type::DECIMAL256 ||
-           itemTypeId == arrow::Type::STRING ||
-           itemTypeId == arrow::Type::LARGE_STRING ||
-           itemTypeId == arrow::Type::STRUCT ||
-           (itemTypeId == arrow::Type::MAP &&
-            IsHandledMapType(
-                std::static_pointer_cast<arrow::MapType>(valueType))) ||
-           ((itemTypeId == arrow::Type::LIST ||
-             itemTypeId == arrow::Type::LARGE_LIST ||
-             itemTypeId == arrow::Type::FIXED_SIZE_LIST) &&
-            IsHandledListType(
-                std::static_pointer_cast<arrow::BaseListType>(valueType)));
+    // Each nesting level only has a single child type to follow, so walk
+    // down iteratively instead of recursing through
+    // IsHandledListType()/IsHandledMapType().
+    std::shared_ptr<arrow::DataType> type = valueType;
+    while (true)
+    {
+        const auto itemTypeId = type->id();
+        if (itemTypeId == arrow::Type::MAP)
+        {
+            const auto mapType =
+                std::static_pointer_cast<arrow::MapType>(type);
+            if (mapType->key_type()->id() != arrow::Type::STRING)
+                return false;
+            type = mapType->item_type();
+        }
+        else if (itemTypeId == arrow::Type::LIST ||
+                 itemTypeId == arrow::Type::LARGE_LIST ||
+                 itemTypeId == arrow::Type::FIXED_SIZE_LIST)
+        {
+            type = std::static_pointer_cast<arrow::BaseListType>(type)
+                       ->value_type();
+        }
+        else
+        {
+            return IsHandledLeafType(itemTypeId);
+        }
+    }
 }
 
 /************************************************************************/
@@ -220,6 +353,73 @@ OGRArrowLayer::IsHandledMapType(const std::shared_ptr<arrow::MapType> &mapType)
            IsHandledListOrMapType(mapType->item_type());
 }
 
+/************************************************************************/
+/*                      GetCachedTimezoneTZFlag()                       */
+/************************************************************************/
+
+// Memoized wrapper around OGRTimezoneToTZFlag(): schemas routinely carry
+// several timestamp fields sharing the same timezone string (e.g. "UTC").
+static int GetCachedTimezoneTZFlag(const std::string &osTZ)
+{
+    if (osTZ.empty())
+        return OGR_TZFLAG_UNKNOWN;
+    static thread_local std::unordered_map<std::string, int> oCache;
+    const auto oIter = oCache.find(osTZ);
+    if (oIter != oCache.end())
+        return oIter->second;
+    const int nTZFlag = OGRTimezoneToTZFlag(osTZ.c_str(), false);
+    oCache[osTZ] = nTZFlag;
+    return nTZFlag;
+}
+
+/************************************************************************/
+/*                      GetOGRTypeForArrowScalar()                      */
+/************************************************************************/
+
+// Flattened mapping for Arrow scalar types whose OGR (type, subtype)
+// translation does not require inspecting the type instance. Returns false
+// for types needing dedicated handling in MapArrowTypeToOGR().
+static bool GetOGRTypeForArrowScalar(arrow::Type::type typeId,
+                                     OGRFieldType &eType,
+                                     OGRFieldSubType &eSubType)
+{
+    struct TypeMapping
+    {
+        OGRFieldType eType;
+        OGRFieldSubType eSubType;
+    };
+    static const std::unordered_map<int, TypeMapping> oMap = {
+        {arrow::Type::BOOL, {OFTInteger, OFSTBoolean}},
+        {arrow::Type::UINT8, {OFTInteger, OFSTNone}},
+        {arrow::Type::INT8, {OFTInteger, OFSTNone}},
+        {arrow::Type::UINT16, {OFTInteger, OFSTNone}},
+        {arrow::Type::INT16, {OFTInteger, OFSTInt16}},
+        {arrow::Type::UINT32, {OFTInteger64, OFSTNone}},
+        {arrow::Type::INT32, {OFTInteger, OFSTNone}},
+        {arrow::Type::UINT64, {OFTReal, OFSTNone}},  // potential loss
+        {arrow::Type::INT64, {OFTInteger64, OFSTNone}},
+        // HALF_FLOAT should use OFSTFloat16 if we had it
+        {arrow::Type::HALF_FLOAT, {OFTReal, OFSTFloat32}},
+        {arrow::Type::FLOAT, {OFTReal, OFSTFloat32}},
+        {arrow::Type::DOUBLE, {OFTReal, OFSTNone}},
+        {arrow::Type::STRING, {OFTString, OFSTNone}},
+        {arrow::Type::LARGE_STRING, {OFTString, OFSTNone}},
+        {arrow::Type::BINARY, {OFTBinary, OFSTNone}},
+        {arrow::Type::LARGE_BINARY, {OFTBinary, OFSTNone}},
+        {arrow::Type::DATE32, {OFTDate, OFSTNone}},
+        {arrow::Type::DATE64, {OFTDate, OFSTNone}},
+        {arrow::Type::TIME32, {OFTTime, OFSTNone}},
+        // our OFTTime doesn't have micro or nanosecond accuracy
+        {arrow::Type::TIME64, {OFTInteger64, OFSTNone}},
+    };
+    const auto oIter = oMap.find(typeId);
+    if (oIter == oMap.end())
+        return false;
+    eType = oIter->second.eType;
+    eSubType = oIter->second.eSubType;
+    return true;
+}
+
 /************************************************************************/
 /*                        MapArrowTypeToOGR()                           */
 /************************************************************************/
@@ -233,209 +433,160 @@ inline bool OGRArrowLayer::MapArrowTypeToOGR(
         &oMapFieldNameToGDALSchemaFieldDefn)
 {
     bool bTypeOK = true;
-    switch (type->id())
+    if (!GetOGRTypeForArrowScalar(type->id(), eType, eSubType))
     {
-        case arrow::Type::NA:
-            break;
-
-        case arrow::Type::BOOL:
-            eType = OFTInteger;
-            eSubType = OFSTBoolean;
-            break;
-        case arrow::Type::UINT8:
-        case arrow::Type::INT8:
-        case arrow::Type::UINT16:
-            eType = OFTInteger;
-            break;
-        case arrow::Type::INT16:
-            eType = OFTInteger;
-            eSubType = OFSTInt16;
-            break;
-        case arrow::Type::UINT32:
-            eType = OFTInteger64;
-            break;
-        case arrow::Type::INT32:
-            eType = OFTInteger;
-            break;
-        case arrow::Type::UINT64:
-            eType = OFTReal;  // potential loss
-            break;
-        case arrow::Type::INT64:
-            eType = OFTInteger64;
-            break;
-        case arrow::Type::HALF_FLOAT:  // should use OFSTFloat16 if we had it
-        case arrow::Type::FLOAT:
-            eType = OFTReal;
-            eSubType = OFSTFloat32;
-            break;
-        case arrow::Type::DOUBLE:
-            eType = OFTReal;
-            break;
-        case arrow::Type::STRING:
-        case arrow::Type::LARGE_STRING:
-            eType = OFTString;
-            break;
-        case arrow::Type::BINARY:
-        case arrow::Type::LARGE_BINARY:
-            eType = OFTBinary;
-            break;
-        case arrow::Type::FIXED_SIZE_BINARY:
-            eType = OFTBinary;
-            oField.SetWidth(
-                std::static_pointer_cast<arrow::FixedSizeBinaryType>(type)
-                    ->byte_width());
-            break;
+        switch (type->id())
+        {
+            case arrow::Type::NA:
+                break;
 
-        case arrow::Type::DATE32:
-        case arrow::Type::DATE64:
-            eType = OFTDate;
-            break;
+            case arrow::Type::FIXED_SIZE_BINARY:
+                eType = OFTBinary;
+                oField.SetWidth(
+                    static_cast<const arrow::FixedSizeBinaryType *>(type.get())
+                        ->byte_width());
+                break;
 
-        case arrow::Type::TIMESTAMP:
-        {
-            const auto timestampType =
-                static_cast<arrow::TimestampType *>(type.get());
-            eType = OFTDateTime;
-            const auto osTZ = timestampType->timezone();
-            int nTZFlag = OGRTimezoneToTZFlag(osTZ.c_str(), false);
-            if (nTZFlag == OGR_TZFLAG_UNKNOWN && !osTZ.empty())
+            case arrow::Type::TIMESTAMP:
             {
-                CPLDebug(GetDriverUCName().c_str(),
-                         "Field %s has unrecognized timezone %s. "
-                         "UTC datetime will be used instead.",
-                         field->name().c_str(), osTZ.c_str());
-                nTZFlag = OGR_TZFLAG_UTC;
+                const auto timestampType =
+                    static_cast<arrow::TimestampType *>(type.get());
+                eType = OFTDateTime;
+                const auto osTZ = timestampType->timezone();
+                int nTZFlag = GetCachedTimezoneTZFlag(osTZ);
+                if (nTZFlag == OGR_TZFLAG_UNKNOWN && !osTZ.empty())
+                {
+                    CPLDebug(GetDriverUCNameCached().c_str(),
+                             "Field %s has unrecognized timezone %s. "
+                             "UTC datetime will be used instead.",
+                             field->name().c_str(), osTZ.c_str());
+                    nTZFlag = OGR_TZFLAG_UTC;
+                }
+                oField.SetTZFlag(nTZFlag);
+                break;
             }
-            oField.SetTZFlag(nTZFlag);
-            break;
-        }
 
-        case arrow::Type::TIME32:
-            eType = OFTTime;
-            break;
-
-        case arrow::Type::TIME64:
-            eType = OFTInteger64;  // our OFTTime doesn't have micro or
-                                   // nanosecond accuracy
-            break;
-
-        case arrow::Type::DECIMAL128:
-        case arrow::Type::DECIMAL256:
-        {
-            const auto decimalType =
-                std::static_pointer_cast<arrow::DecimalType>(type);
-            eType = OFTReal;
-            oField.SetWidth(decimalType->precision());
-            oField.SetPrecision(decimalType->scale());
-            break;
-        }
+            case arrow::Type::DECIMAL128:
+            case arrow::Type::DECIMAL256:
+            {
+                const auto decimalType =
+                    static_cast<const arrow::DecimalType *>(type.get());
+                eType = OFTReal;
+                oField.SetWidth(decimalType->precision());
+                oField.SetPrecision(decimalType->scale());
+                break;
+            }
 
-        case arrow::Type::LIST:
-        case arrow::Type::FIXED_SIZE_LIST:
-        {
-            auto listType = std::static_pointer_cast<arrow::BaseListType>(type);
-            switch (listType->value_type()->id())
+            case arrow::Type::LIST:
+            case arrow::Type::FIXED_SIZE_LIST:
             {
-                case arrow::Type::BOOL:
-                    eType = OFTIntegerList;
-                    eSubType = OFSTBoolean;
-                    break;
-                case arrow::Type::UINT8:
-                case arrow::Type::INT8:
-                case arrow::Type::UINT16:
-                case arrow::Type::INT16:
-                case arrow::Type::INT32:
-                    eType = OFTIntegerList;
-                    break;
-                case arrow::Type::UINT32:
-                    eType = OFTInteger64List;
-                    break;
-                case arrow::Type::UINT64:
-                    eType = OFTRealList;  // potential loss
-                    break;
-                case arrow::Type::INT64:
-                    eType = OFTInteger64List;
-                    break;
-                case arrow::Type::HALF_FLOAT:  // should use OFSTFloat16 if we
-                                               // had it
-                case arrow::Type::FLOAT:
-                    eType = OFTRealList;
-                    eSubType = OFSTFloat32;
-                    break;
-                case arrow::Type::DOUBLE:
-                case arrow::Type::DECIMAL128:
-                case arrow::Type::DECIMAL256:
-                    eType = OFTRealList;
-                    break;
-                case arrow::Type::STRING:
-                case arrow::Type::LARGE_STRING:
-                    eType = OFTStringList;
-                    break;
-                default:
+                const auto listType =
+                    static_cast<const arrow::BaseListType *>(type.get());
+                switch (listType->value_type()->id())
                 {
-                    if (IsHandledListType(listType))
-                    {
-                        eType = OFTString;
-                        eSubType = OFSTJSON;
-                    }
-                    else
+                    case arrow::Type::BOOL:
+                        eType = OFTIntegerList;
+                        eSubType = OFSTBoolean;
+                        break;
+                    case arrow::Type::UINT8:
+                    case arrow::Type::INT8:
+                    case arrow::Type::UINT16:
+                    case arrow::Type::INT16:
+                    case arrow::Type::INT32:
+                        eType = OFTIntegerList;
+                        break;
+                    case arrow::Type::UINT32:
+                        eType = OFTInteger64List;
+                        break;
+                    case arrow::Type::UINT64:
+                        eType = OFTRealList;  // potential loss
+                        break;
+                    case arrow::Type::INT64:
+                        eType = OFTInteger64List;
+                        break;
+                    case arrow::Type::HALF_FLOAT:  // should use OFSTFloat16
+                                                   // if we had it
+                    case arrow::Type::FLOAT:
+                        eType = OFTRealList;
+                        eSubType = OFSTFloat32;
+                        break;
+                    case arrow::Type::DOUBLE:
+                    case arrow::Type::DECIMAL128:
+                    case arrow::Type::DECIMAL256:
+                        eType = OFTRealList;
+                        break;
+                    case arrow::Type::STRING:
+                    case arrow::Type::LARGE_STRING:
+                        eType = OFTStringList;
+                        break;
+                    default:
                     {
-                        bTypeOK = false;
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Field %s of unhandled type %s ignored",
-                                 field->name().c_str(),
-                                 type->ToString().c_str());
+                        if (IsHandledListOrMapType(listType->value_type()))
+                        {
+                            eType = OFTString;
+                            eSubType = OFSTJSON;
+                        }
+                        else
+                        {
+                            bTypeOK = false;
+                            CPLError(CE_Warning, CPLE_AppDefined,
+                                     "Field %s of unhandled type %s ignored",
+                                     field->name().c_str(),
+                                     type->ToString().c_str());
+                        }
+                        break;
                     }
-                    break;
                 }
+                break;
             }
-            break;
-        }
 
-        case arrow::Type::MAP:
-        {
-            auto mapType = std::static_pointer_cast<arrow::MapType>(type);
-            if (IsHandledMapType(mapType))
+            case arrow::Type::MAP:
             {
-                eType = OFTString;
-                eSubType = OFSTJSON;
+                const auto mapType =
+                    static_cast<const arrow::MapType *>(type.get());
+                if (mapType->key_type()->id() == arrow::Type::STRING &&
+                    IsHandledListOrMapType(mapType->item_type()))
+                {
+                    eType = OFTString;
+                    eSubType = OFSTJSON;
+                }
+                else
+                {
+                    bTypeOK = false;
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "Field %s of unhandled type %s ignored",
+                             field->name().c_str(), type->ToString().c_str());
+                }
+                break;
             }
-            else
+
+            case arrow::Type::STRUCT:
+                // should be handled by specialized code
+                CPLAssert(false);
+                break;
+
+                // unhandled types
+
+            case arrow::Type::INTERVAL_MONTHS:
+            case arrow::Type::INTERVAL_DAY_TIME:
+            case arrow::Type::SPARSE_UNION:
+            case arrow::Type::DENSE_UNION:
+            case arrow::Type::DICTIONARY:
+            case arrow::Type::EXTENSION:
+            case arrow::Type::DURATION:
+            case arrow::Type::LARGE_LIST:
+            case arrow::Type::INTERVAL_MONTH_DAY_NANO:
+#if ARROW_VERSION_MAJOR >= 12
+            case arrow::Type::RUN_END_ENCODED:
+#endif
+            case arrow::Type::MAX_ID:
             {
                 bTypeOK = false;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Field %s of unhandled type %s ignored",
                          field->name().c_str(), type->ToString().c_str());
+                break;
             }
-            break;
-        }
-
-        case arrow::Type::STRUCT:
-            // should be handled by specialized code
-            CPLAssert(false);
-            break;
-
-            // unhandled types
-
-        case arrow::Type::INTERVAL_MONTHS:
-        case arrow::Type::INTERVAL_DAY_TIME:
-        case arrow::Type::SPARSE_UNION:
-        case arrow::Type::DENSE_UNION:
-        case arrow::Type::DICTIONARY:
-        case arrow::Type::EXTENSION:
-        case arrow::Type::DURATION:
-        case arrow::Type::LARGE_LIST:
-        case arrow::Type::INTERVAL_MONTH_DAY_NANO:
-#if ARROW_VERSION_MAJOR >= 12
-        case arrow::Type::RUN_END_ENCODED:
-#endif
-        case arrow::Type::MAX_ID:
-        {
-            bTypeOK = false;
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Field %s of unhandled type %s ignored",
-                     field->name().c_str(), type->ToString().c_str());
-            break;
         }
     }
 
@@ -456,7 +607,7 @@ inline bool OGRArrowLayer::MapArrowTypeToOGR(
                 else if (eSubType != poGDALFieldDefn->GetSubType())
                 {
                     CPLDebug(
-                        GetDriverUCName().c_str(),
+                        GetDriverUCNameCached().c_str(),
                         "Field subtype inferred from Parquet/Arrow schema is "
                         "%s, "
                         "whereas the one in gdal:schema is %s. "
@@ -467,7 +618,7 @@ inline bool OGRArrowLayer::MapArrowTypeToOGR(
             }
             else
             {
-                CPLDebug(GetDriverUCName().c_str(),
+                CPLDebug(GetDriverUCNameCached().c_str(),
                          "Field type inferred from Parquet/Arrow schema is %s, "
                          "whereas the one in gdal:schema is %s. "
                          "Using the former one.",
@@ -488,14 +639,21 @@ inline bool OGRArrowLayer::MapArrowTypeToOGR(
         oField.SetNullable(field->nullable());
         if (type->id() == arrow::Type::DOUBLE)
         {
-            if (field->name() == "bbox.minx")
-                m_iBBOXMinXField = m_poFeatureDefn->GetFieldCount();
-            else if (field->name() == "bbox.miny")
-                m_iBBOXMinYField = m_poFeatureDefn->GetFieldCount();
-            else if (field->name() == "bbox.maxx")
-                m_iBBOXMaxXField = m_poFeatureDefn->GetFieldCount();
-            else if (field->name() == "bbox.maxy")
-                m_iBBOXMaxYField = m_poFeatureDefn->GetFieldCount();
+            // All four candidate names share the "bbox.m" prefix: check it
+            // once instead of doing four full string comparisons per field.
+            const char *pszFieldName = field->name().c_str();
+            if (STARTS_WITH(pszFieldName, "bbox.m"))
+            {
+                const char *pszSuffix = pszFieldName + strlen("bbox.m");
+                if (strcmp(pszSuffix, "inx") == 0)
+                    m_iBBOXMinXField = m_poFeatureDefn->GetFieldCount();
+                else if (strcmp(pszSuffix, "iny") == 0)
+                    m_iBBOXMinYField = m_poFeatureDefn->GetFieldCount();
+                else if (strcmp(pszSuffix, "axx") == 0)
+                    m_iBBOXMaxXField = m_poFeatureDefn->GetFieldCount();
+                else if (strcmp(pszSuffix, "axy") == 0)
+                    m_iBBOXMaxYField = m_poFeatureDefn->GetFieldCount();
+            }
         }
         m_poFeatureDefn->AddFieldDefn(&oField);
         m_anMapFieldIndexToArrowColumn.push_back(path);
@@ -509,7 +667,7 @@ inline bool OGRArrowLayer::MapArrowTypeToOGR(
 /************************************************************************/
 
 inline void OGRArrowLayer::CreateFieldFromSchema(
-    const std::shared_ptr<arrow::Field> &field, const std::vector<int> &path,
+    const std::shared_ptr<arrow::Field> &field, std::vector<int> &path,
     const std::map<std::string, std::unique_ptr<OGRFieldDefn>>
         &oMapFieldNameToGDALSchemaFieldDefn)
 {
@@ -542,15 +700,17 @@ inline void OGRArrowLayer::CreateFieldFromSchema(
     if (type->id() == arrow::Type::STRUCT)
     {
         const auto subfields = field->Flatten();
-        auto newpath = path;
-        newpath.push_back(0);
+        // Mutate-and-restore the path rather than copying it at each
+        // recursion level.
+        path.push_back(0);
         for (int j = 0; j < static_cast<int>(subfields.size()); j++)
         {
             const auto &subfield = subfields[j];
-            newpath.back() = j;
-            CreateFieldFromSchema(subfield, newpath,
+            path.back() = j;
+            CreateFieldFromSchema(subfield, path,
                                   oMapFieldNameToGDALSchemaFieldDefn);
         }
+        path.pop_back();
     }
     else if (bTypeOK)
     {
@@ -584,8 +744,19 @@ inline std::unique_ptr<OGRFieldDomain> OGRArrowLayer::BuildDomainFromBatch(
         if (!values->IsNull(i))
         {
             OGRCodedValue val;
-            val.pszCode = CPLStrdup(CPLSPrintf("%d", i));
-            val.pszValue = CPLStrdup(values->GetString(i).c_str());
+            // Formatting into a stack buffer avoids the rotating static
+            // buffer (and associated locking) of CPLSPrintf()
+            char szCode[16];
+            snprintf(szCode, sizeof(szCode), "%d", i);
+            val.pszCode = CPLStrdup(szCode);
+            // Copy the raw value directly rather than going through a
+            // std::string temporary
+            int out_length = 0;
+            const uint8_t *data = values->GetValue(i, &out_length);
+            char *pszValue = static_cast<char *>(CPLMalloc(out_length + 1));
+            memcpy(pszValue, data, out_length);
+            pszValue[out_length] = 0;
+            val.pszValue = pszValue;
             asValues.emplace_back(val);
         }
     }
@@ -602,102 +773,179 @@ inline OGRwkbGeometryType OGRArrowLayer::ComputeGeometryColumnTypeProcessBatch(
     int iBatchCol, OGRwkbGeometryType eGeomType) const
 {
     const auto array = poBatch->column(iBatchCol);
+    // Resolve the encoding and the concrete array type once for the whole
+    // batch: the loop body then only tests which pointer is non-null.
+    const auto eEncoding = m_aeGeomEncoding[iGeomCol];
     const auto castBinaryArray =
-        (m_aeGeomEncoding[iGeomCol] == OGRArrowGeomEncoding::WKB)
+        (eEncoding == OGRArrowGeomEncoding::WKB)
             ? std::dynamic_pointer_cast<arrow::BinaryArray>(array)
             : nullptr;
     const auto castLargeBinaryArray =
-        (m_aeGeomEncoding[iGeomCol] == OGRArrowGeomEncoding::WKB)
+        (eEncoding == OGRArrowGeomEncoding::WKB)
             ? std::dynamic_pointer_cast<arrow::LargeBinaryArray>(array)
             : nullptr;
     const auto castStringArray =
-        (m_aeGeomEncoding[iGeomCol] == OGRArrowGeomEncoding::WKT)
+        (eEncoding == OGRArrowGeomEncoding::WKT)
             ? std::dynamic_pointer_cast<arrow::StringArray>(array)
             : nullptr;
     const auto castLargeStringArray =
-        (m_aeGeomEncoding[iGeomCol] == OGRArrowGeomEncoding::WKT)
+        (eEncoding == OGRArrowGeomEncoding::WKT)
             ? std::dynamic_pointer_cast<arrow::LargeStringArray>(array)
             : nullptr;
-    for (int64_t i = 0; i < poBatch->num_rows(); i++)
+    // Access the offsets and data buffers directly rather than going
+    // through GetValue() for each row.
+    const auto *panBinaryOffsets =
+        castBinaryArray ? castBinaryArray->raw_value_offsets() : nullptr;
+    const uint8_t *pabyBinaryData =
+        castBinaryArray ? castBinaryArray->raw_data() : nullptr;
+    const auto *panLargeBinaryOffsets =
+        castLargeBinaryArray ? castLargeBinaryArray->raw_value_offsets()
+                             : nullptr;
+    const uint8_t *pabyLargeBinaryData =
+        castLargeBinaryArray ? castLargeBinaryArray->raw_data() : nullptr;
+    const auto *panStringOffsets =
+        castStringArray ? castStringArray->raw_value_offsets() : nullptr;
+    const char *pachStringData =
+        castStringArray
+            ? reinterpret_cast<const char *>(castStringArray->raw_data())
+            : nullptr;
+    const auto *panLargeStringOffsets =
+        castLargeStringArray ? castLargeStringArray->raw_value_offsets()
+                             : nullptr;
+    const char *pachLargeStringData =
+        castLargeStringArray
+            ? reinterpret_cast<const char *>(castLargeStringArray->raw_data())
+            : nullptr;
+    const int64_t nRows = poBatch->num_rows();
+    // Fetch the validity bitmap once rather than going through the generic
+    // IsNull() path for each row, and skip whole bytes of null rows at once.
+    const uint8_t *pabyValidity =
+        array->null_count() != 0 ? array->null_bitmap_data() : nullptr;
+    const int64_t nArrayOffset = array->offset();
+    // Index (exclusive) until which all rows are known to be valid, so that
+    // the per-row bit test can be skipped for fully valid validity bytes.
+    int64_t nAllValidUntil = 0;
+    for (int64_t i = 0; i < nRows; i++)
     {
-        if (!array->IsNull(i))
+        if (pabyValidity && i >= nAllValidUntil)
         {
-            OGRwkbGeometryType eThisGeomType = wkbNone;
-            if (m_aeGeomEncoding[iGeomCol] == OGRArrowGeomEncoding::WKB &&
-                castBinaryArray)
+            const int64_t iBit = nArrayOffset + i;
+            if ((iBit % 8) == 0 && i + 8 <= nRows)
             {
-                arrow::BinaryArray::offset_type out_length = 0;
-                const uint8_t *data = castBinaryArray->GetValue(i, &out_length);
-                if (out_length >= 5)
+                const uint8_t byValidity = pabyValidity[iBit / 8];
+                if (byValidity == 0)
                 {
-                    OGRReadWKBGeometryType(data, wkbVariantIso, &eThisGeomType);
+                    // All 8 rows covered by this validity byte are null
+                    i += 7;
+                    continue;
                 }
-            }
-            else if (m_aeGeomEncoding[iGeomCol] == OGRArrowGeomEncoding::WKB &&
-                     castLargeBinaryArray)
+                else if (byValidity == 0xFF)
+                {
+                    // All 8 rows covered by this validity byte are valid
+                    nAllValidUntil = i + 8;
+                }
+            }
+            if (i >= nAllValidUntil &&
+                ((pabyValidity[iBit / 8] >> (iBit % 8)) & 1) == 0)
+                continue;
+        }
+        {
+            OGRwkbGeometryType eThisGeomType = wkbNone;
+            if (castBinaryArray)
+            {
+                const auto out_length =
+                    panBinaryOffsets[i + 1] - panBinaryOffsets[i];
+                if (out_length >= 5)
+                {
+                    OGRReadWKBGeometryType(pabyBinaryData + panBinaryOffsets[i],
+                                           wkbVariantIso, &eThisGeomType);
+                }
+            }
+            else if (castLargeBinaryArray)
             {
-                arrow::LargeBinaryArray::offset_type out_length = 0;
-                const uint8_t *data =
-                    castLargeBinaryArray->GetValue(i, &out_length);
+                const auto out_length =
+                    panLargeBinaryOffsets[i + 1] - panLargeBinaryOffsets[i];
                 if (out_length >= 5)
                 {
-                    OGRReadWKBGeometryType(data, wkbVariantIso, &eThisGeomType);
+                    OGRReadWKBGeometryType(pabyLargeBinaryData +
+                                               panLargeBinaryOffsets[i],
+                                           wkbVariantIso, &eThisGeomType);
                 }
             }
-            else if (m_aeGeomEncoding[iGeomCol] == OGRArrowGeomEncoding::WKT &&
-                     castStringArray)
+            else if (castStringArray)
             {
-                const auto osWKT = castStringArray->GetString(i);
-                if (!osWKT.empty())
+                const auto out_length =
+                    panStringOffsets[i + 1] - panStringOffsets[i];
+                if (out_length > 0)
                 {
-                    OGRReadWKTGeometryType(osWKT.c_str(), &eThisGeomType);
+                    // OGRReadWKTGeometryType() only looks at the geometry
+                    // type token and the optional Z/M modifier, so copy the
+                    // head of the WKT string into a small NUL-terminated
+                    // buffer instead of instantiating a std::string for the
+                    // whole geometry.
+                    char szHeader[32];
+                    const size_t nHeaderLen =
+                        std::min(static_cast<size_t>(out_length),
+                                 sizeof(szHeader) - 1);
+                    memcpy(szHeader, pachStringData + panStringOffsets[i],
+                           nHeaderLen);
+                    szHeader[nHeaderLen] = 0;
+                    OGRReadWKTGeometryType(szHeader, &eThisGeomType);
                 }
             }
-            else if (m_aeGeomEncoding[iGeomCol] == OGRArrowGeomEncoding::WKT &&
-                     castLargeStringArray)
+            else if (castLargeStringArray)
             {
-                const auto osWKT = castLargeStringArray->GetString(i);
-                if (!osWKT.empty())
+                const auto out_length =
+                    panLargeStringOffsets[i + 1] - panLargeStringOffsets[i];
+                if (out_length > 0)
                 {
-                    OGRReadWKTGeometryType(osWKT.c_str(), &eThisGeomType);
+                    char szHeader[32];
+                    const size_t nHeaderLen =
+                        std::min(static_cast<size_t>(out_length),
+                                 sizeof(szHeader) - 1);
+                    memcpy(szHeader,
+                           pachLargeStringData + panLargeStringOffsets[i],
+                           nHeaderLen);
+                    szHeader[nHeaderLen] = 0;
+                    OGRReadWKTGeometryType(szHeader, &eThisGeomType);
                 }
             }
 
             if (eThisGeomType != wkbNone)
             {
+                // Compute the flattened types and merged Z/M flags once:
+                // the final OGR_GT_SetModifier() below takes care of the
+                // dimensionality in all branches.
+                const auto eFlatThis = wkbFlatten(eThisGeomType);
+                const auto eFlatCur = wkbFlatten(eGeomType);
+                const int bHasZ =
+                    OGR_GT_HasZ(eThisGeomType) || OGR_GT_HasZ(eGeomType);
+                const int bHasM =
+                    OGR_GT_HasM(eThisGeomType) || OGR_GT_HasM(eGeomType);
                 if (eGeomType == wkbNone)
                     eGeomType = eThisGeomType;
-                else if (wkbFlatten(eThisGeomType) == wkbFlatten(eGeomType))
+                else if (eFlatThis == eFlatCur)
                     ;
-                else if (wkbFlatten(eThisGeomType) == wkbMultiLineString &&
-                         wkbFlatten(eGeomType) == wkbLineString)
+                else if (eFlatThis == wkbMultiLineString &&
+                         eFlatCur == wkbLineString)
                 {
-                    eGeomType = OGR_GT_SetModifier(
-                        wkbMultiLineString,
-                        OGR_GT_HasZ(eThisGeomType) || OGR_GT_HasZ(eGeomType),
-                        OGR_GT_HasM(eThisGeomType) || OGR_GT_HasM(eGeomType));
+                    eGeomType = wkbMultiLineString;
                 }
-                else if (wkbFlatten(eThisGeomType) == wkbLineString &&
-                         wkbFlatten(eGeomType) == wkbMultiLineString)
+                else if (eFlatThis == wkbLineString &&
+                         eFlatCur == wkbMultiLineString)
                     ;
-                else if (wkbFlatten(eThisGeomType) == wkbMultiPolygon &&
-                         wkbFlatten(eGeomType) == wkbPolygon)
+                else if (eFlatThis == wkbMultiPolygon &&
+                         eFlatCur == wkbPolygon)
                 {
-                    eGeomType = OGR_GT_SetModifier(
-                        wkbMultiPolygon,
-                        OGR_GT_HasZ(eThisGeomType) || OGR_GT_HasZ(eGeomType),
-                        OGR_GT_HasM(eThisGeomType) || OGR_GT_HasM(eGeomType));
+                    eGeomType = wkbMultiPolygon;
                 }
-                else if (wkbFlatten(eThisGeomType) == wkbPolygon &&
-                         wkbFlatten(eGeomType) == wkbMultiPolygon)
+                else if (eFlatThis == wkbPolygon &&
+                         eFlatCur == wkbMultiPolygon)
                     ;
                 else
                     return wkbUnknown;
 
-                eGeomType = OGR_GT_SetModifier(
-                    eGeomType,
-                    OGR_GT_HasZ(eThisGeomType) || OGR_GT_HasZ(eGeomType),
-                    OGR_GT_HasM(eThisGeomType) || OGR_GT_HasM(eGeomType));
+                eGeomType = OGR_GT_SetModifier(eGeomType, bHasZ, bHasM);
             }
         }
     }
@@ -753,13 +1001,117 @@ static bool IsPointType(const std::shared_ptr<arrow::DataType> &type,
 static bool IsListOfPointType(const std::shared_ptr<arrow::DataType> &type,
                               int nDepth, bool &bHasZOut, bool &bHasMOut)
 {
-    if (type->id() != arrow::Type::LIST)
-        return false;
-    auto poListType = std::static_pointer_cast<arrow::ListType>(type);
-    return nDepth == 1
-               ? IsPointType(poListType->value_type(), bHasZOut, bHasMOut)
-               : IsListOfPointType(poListType->value_type(), nDepth - 1,
-                                   bHasZOut, bHasMOut);
+    // Unwrap the nDepth levels of list<> iteratively, rather than
+    // recursing with a shared_ptr copy (and its refcounting) per level.
+    auto curType = type;
+    for (int i = 0; i < nDepth; ++i)
+    {
+        if (curType->id() != arrow::Type::LIST)
+            return false;
+        curType =
+            static_cast<const arrow::ListType *>(curType.get())->value_type();
+    }
+    return IsPointType(curType, bHasZOut, bHasMOut);
+}
+
+/************************************************************************/
+/*                     GetGeomEncodingFromString()                      */
+/************************************************************************/
+
+// Identify a geometry encoding string with a single test on its length
+// followed by at most two full comparisons, instead of comparing it
+// against each known encoding in turn.
+static bool GetGeomEncodingFromString(const std::string &osEncoding,
+                                      OGRArrowGeomEncoding &eEncodingOut)
+{
+    switch (osEncoding.size())
+    {
+        case 3:
+            // As used in Parquet geo metadata
+            if (osEncoding == "WKB")
+            {
+                // By far the most common encoding: test it first
+                eEncodingOut = OGRArrowGeomEncoding::WKB;
+                return true;
+            }
+            if (osEncoding == "WKT")
+            {
+                eEncodingOut = OGRArrowGeomEncoding::WKT;
+                return true;
+            }
+            break;
+        case 7:
+            // As used in ARROW:extension:name field metadata
+            if (osEncoding == "ogc.wkb")
+            {
+                // By far the most common encoding: test it first
+                eEncodingOut = OGRArrowGeomEncoding::WKB;
+                return true;
+            }
+            if (osEncoding == "ogc.wkt")
+            {
+                eEncodingOut = OGRArrowGeomEncoding::WKT;
+                return true;
+            }
+            break;
+        case 12:
+            // As used in ARROW:extension:name field metadata
+            if (osEncoding == "geoarrow.wkb")
+            {
+                // By far the most common encoding: test it first
+                eEncodingOut = OGRArrowGeomEncoding::WKB;
+                return true;
+            }
+            if (osEncoding == "geoarrow.wkt")
+            {
+                eEncodingOut = OGRArrowGeomEncoding::WKT;
+                return true;
+            }
+            break;
+        case 14:
+            if (osEncoding == "geoarrow.point")
+            {
+                eEncodingOut = OGRArrowGeomEncoding::GEOARROW_POINT;
+                return true;
+            }
+            break;
+        case 16:
+            if (osEncoding == "geoarrow.polygon")
+            {
+                eEncodingOut = OGRArrowGeomEncoding::GEOARROW_POLYGON;
+                return true;
+            }
+            break;
+        case 19:
+            if (osEncoding == "geoarrow.linestring")
+            {
+                eEncodingOut = OGRArrowGeomEncoding::GEOARROW_LINESTRING;
+                return true;
+            }
+            if (osEncoding == "geoarrow.multipoint")
+            {
+                eEncodingOut = OGRArrowGeomEncoding::GEOARROW_MULTIPOINT;
+                return true;
+            }
+            break;
+        case 21:
+            if (osEncoding == "geoarrow.multipolygon")
+            {
+                eEncodingOut = OGRArrowGeomEncoding::GEOARROW_MULTIPOLYGON;
+                return true;
+            }
+            break;
+        case 24:
+            if (osEncoding == "geoarrow.multilinestring")
+            {
+                eEncodingOut = OGRArrowGeomEncoding::GEOARROW_MULTILINESTRING;
+                return true;
+            }
+            break;
+        default:
+            break;
+    }
+    return false;
 }
 
 /************************************************************************/
@@ -785,12 +1137,19 @@ inline bool OGRArrowLayer::IsValidGeometryEncoding(
 
     eGeomTypeOut = wkbUnknown;
 
-    if (osEncoding == "WKT" ||  // As used in Parquet geo metadata
-        osEncoding ==
-            "ogc.wkt" ||  // As used in ARROW:extension:name field metadata
-        osEncoding ==
-            "geoarrow.wkt"  // As used in ARROW:extension:name field metadata
-    )
+    OGRArrowGeomEncoding eEncoding = OGRArrowGeomEncoding::WKB;
+    if (!GetGeomEncodingFromString(osEncoding, eEncoding))
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Geometry column %s uses a unhandled encoding: %s. "
+                 "Handling it as a regular field",
+                 fieldName.c_str(), osEncoding.c_str());
+        return false;
+    }
+
+    bool bHasZ = false;
+    bool bHasM = false;
+    if (eEncoding == OGRArrowGeomEncoding::WKT)
     {
         if (fieldTypeId != arrow::Type::LARGE_STRING &&
             fieldTypeId != arrow::Type::STRING)
@@ -805,12 +1164,7 @@ inline bool OGRArrowLayer::IsValidGeometryEncoding(
         return true;
     }
 
-    if (osEncoding == "WKB" ||  // As used in Parquet geo metadata
-        osEncoding ==
-            "ogc.wkb" ||  // As used in ARROW:extension:name field metadata
-        osEncoding ==
-            "geoarrow.wkb"  // As used in ARROW:extension:name field metadata
-    )
+    if (eEncoding == OGRArrowGeomEncoding::WKB)
     {
         if (fieldTypeId != arrow::Type::LARGE_BINARY &&
             fieldTypeId != arrow::Type::BINARY)
@@ -825,252 +1179,406 @@ inline bool OGRArrowLayer::IsValidGeometryEncoding(
         return true;
     }
 
-    bool bHasZ = false;
-    bool bHasM = false;
-    if (osEncoding == "geoarrow.point")
+    // All GeoArrow native encodings share the same validation shape: a
+    // number of list<> nesting levels around a fixed_size_list<xy:
+    // double>[2] point layout, and a base geometry type. Drive the checks
+    // from a table instead of one hand-written arm per encoding.
+    struct GeoArrowTypeEntry
     {
-        if (!IsPointType(fieldType, bHasZ, bHasM))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Geometry column %s has a type != fixed_size_list<xy: "
-                     "double>[2]>: %s. "
-                     "Handling it as a regular field",
-                     fieldName.c_str(), fieldType->name().c_str());
-            return false;
+        OGRArrowGeomEncoding eEncoding;
+        OGRwkbGeometryType eGeomType;
+        int nListNestingLevels;
+        const char *pszExpectedLayout;
+    };
+    static const GeoArrowTypeEntry asGeoArrowTypes[] = {
+        {OGRArrowGeomEncoding::GEOARROW_POINT, wkbPoint, 0,
+         "fixed_size_list<xy: double>[2]>"},
+        {OGRArrowGeomEncoding::GEOARROW_LINESTRING, wkbLineString, 1,
+         "fixed_size_list<xy: double>[2]>"},
+        {OGRArrowGeomEncoding::GEOARROW_POLYGON, wkbPolygon, 2,
+         "list<vertices: fixed_size_list<xy: double>[2]>>"},
+        {OGRArrowGeomEncoding::GEOARROW_MULTIPOINT, wkbMultiPoint, 1,
+         "fixed_size_list<xy: double>[2]>"},
+        {OGRArrowGeomEncoding::GEOARROW_MULTILINESTRING, wkbMultiLineString, 2,
+         "list<vertices: fixed_size_list<xy: double>[2]>>"},
+        {OGRArrowGeomEncoding::GEOARROW_MULTIPOLYGON, wkbMultiPolygon, 3,
+         "list<polygons: list<rings: "
+         "list<vertices: fixed_size_list<xy: double>[2]>>>"},
+    };
+    for (const auto &sEntry : asGeoArrowTypes)
+    {
+        if (sEntry.eEncoding == eEncoding)
+        {
+            const bool bTypeOK =
+                sEntry.nListNestingLevels == 0
+                    ? IsPointType(fieldType, bHasZ, bHasM)
+                    : IsListOfPointType(fieldType, sEntry.nListNestingLevels,
+                                        bHasZ, bHasM);
+            if (!bTypeOK)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Geometry column %s has a type != %s: %s. "
+                         "Handling it as a regular field",
+                         fieldName.c_str(), sEntry.pszExpectedLayout,
+                         fieldType->name().c_str());
+                return false;
+            }
+            eGeomTypeOut =
+                OGR_GT_SetModifier(sEntry.eGeomType, static_cast<int>(bHasZ),
+                                   static_cast<int>(bHasM));
+            eOGRArrowGeomEncodingOut = sEntry.eEncoding;
+            return true;
         }
-        eGeomTypeOut = OGR_GT_SetModifier(wkbPoint, static_cast<int>(bHasZ),
-                                          static_cast<int>(bHasM));
-        eOGRArrowGeomEncodingOut = OGRArrowGeomEncoding::GEOARROW_POINT;
-        return true;
     }
 
-    if (osEncoding == "geoarrow.linestring")
+    // GEOARROW_GENERIC is not emitted by GetGeomEncodingFromString()
+    CPLAssert(false);
+    return false;
+}
+
+/************************************************************************/
+/*                    GetGeometryTypeFromString()                       */
+/************************************************************************/
+
+inline OGRwkbGeometryType
+OGRArrowLayer::GetGeometryTypeFromString(const std::string &osType)
+{
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    OGRReadWKTGeometryType(osType.c_str(), &eGeomType);
+    if (eGeomType == wkbUnknown && !osType.empty())
     {
-        if (!IsListOfPointType(fieldType, 1, bHasZ, bHasM))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Geometry column %s has a type != fixed_size_list<xy: "
-                     "double>[2]>: %s. "
-                     "Handling it as a regular field",
-                     fieldName.c_str(), fieldType->name().c_str());
-            return false;
-        }
-        eGeomTypeOut = OGR_GT_SetModifier(
-            wkbLineString, static_cast<int>(bHasZ), static_cast<int>(bHasM));
-        eOGRArrowGeomEncodingOut = OGRArrowGeomEncoding::GEOARROW_LINESTRING;
-        return true;
+        CPLDebug("ARROW", "Unknown geometry type: %s", osType.c_str());
     }
+    return eGeomType;
+}
+
+static void WriteObjectAsJSON(CPLJSonStreamingWriter &oWriter,
+                              const arrow::Array *array, const size_t nIdx);
+
+/************************************************************************/
+/*                         GetHalfFloatValue()                          */
+/************************************************************************/
+
+// Shared decode of an Arrow half-float element into a float.
+static inline float GetHalfFloatValue(const uint16_t nFloat16)
+{
+    const uint32_t nFloat32 = CPLHalfToFloat(nFloat16);
+    float f;
+    memcpy(&f, &nFloat32, sizeof(nFloat32));
+    return f;
+}
+
+/************************************************************************/
+/*                        GetDecimalAsDouble()                          */
+/************************************************************************/
+
+// Convert a decimal element to double directly from its binary
+// representation, rather than formatting it to a string with
+// FormatValue() and parsing that string back with CPLAtof().
+
+static int32_t GetDecimalScale(const arrow::Array *array)
+{
+    return static_cast<const arrow::DecimalType *>(array->type().get())
+        ->scale();
+}
+
+static double GetDecimalAsDouble(const arrow::Decimal128Array *array,
+                                 const size_t nIdx, const int32_t nScale)
+{
+    return arrow::Decimal128(array->GetValue(nIdx)).ToDouble(nScale);
+}
+
+static double GetDecimalAsDouble(const arrow::Decimal256Array *array,
+                                 const size_t nIdx, const int32_t nScale)
+{
+    return arrow::Decimal256(array->GetValue(nIdx)).ToDouble(nScale);
+}
 
-    if (osEncoding == "geoarrow.polygon")
+/************************************************************************/
+/*                          ForEachMaybeNull()                          */
+/************************************************************************/
+
+// Invoke nonNull(k) or isNull(k) for each k in [0, nCount), depending on
+// the validity of element nIdxStart + k of values. Arrays without any
+// null skip the bitmap entirely, and the bitmap is otherwise read one
+// byte at a time, so that runs of 8 all-valid or 8 all-null elements are
+// handled with a single test instead of a load + shift + mask per
+// element.
+// Return whether all the bits of [nStart, nStart + nCount) are set.
+static bool IsBitRangeAllSet(const uint8_t *pabyBitmap, const size_t nStart,
+                             const size_t nCount)
+{
+    size_t i = nStart;
+    const size_t nEnd = nStart + nCount;
+    for (; i < nEnd && (i % 8) != 0; ++i)
     {
-        if (!IsListOfPointType(fieldType, 2, bHasZ, bHasM))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Geometry column %s has a type != list<vertices: "
-                     "fixed_size_list<xy: double>[2]>>: %s. "
-                     "Handling it as a regular field",
-                     fieldName.c_str(), fieldType->name().c_str());
+        if (!(pabyBitmap[i / 8] & (1 << (i % 8))))
+            return false;
+    }
+    for (; i + 8 <= nEnd; i += 8)
+    {
+        if (pabyBitmap[i / 8] != 0xFF)
+            return false;
+    }
+    for (; i < nEnd; ++i)
+    {
+        if (!(pabyBitmap[i / 8] & (1 << (i % 8))))
             return false;
-        }
-        eGeomTypeOut = OGR_GT_SetModifier(wkbPolygon, static_cast<int>(bHasZ),
-                                          static_cast<int>(bHasM));
-        eOGRArrowGeomEncodingOut = OGRArrowGeomEncoding::GEOARROW_POLYGON;
-        return true;
     }
+    return true;
+}
 
-    if (osEncoding == "geoarrow.multipoint")
+// Return whether all the bits of [nStart, nStart + nCount) are unset.
+static bool IsBitRangeAllUnset(const uint8_t *pabyBitmap, const size_t nStart,
+                               const size_t nCount)
+{
+    size_t i = nStart;
+    const size_t nEnd = nStart + nCount;
+    for (; i < nEnd && (i % 8) != 0; ++i)
     {
-        if (!IsListOfPointType(fieldType, 1, bHasZ, bHasM))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Geometry column %s has a type != fixed_size_list<xy: "
-                     "double>[2]>: %s. "
-                     "Handling it as a regular field",
-                     fieldName.c_str(), fieldType->name().c_str());
+        if (pabyBitmap[i / 8] & (1 << (i % 8)))
+            return false;
+    }
+    for (; i + 8 <= nEnd; i += 8)
+    {
+        if (pabyBitmap[i / 8] != 0)
             return false;
-        }
-        eGeomTypeOut = OGR_GT_SetModifier(
-            wkbMultiPoint, static_cast<int>(bHasZ), static_cast<int>(bHasM));
-        eOGRArrowGeomEncodingOut = OGRArrowGeomEncoding::GEOARROW_MULTIPOINT;
-        return true;
     }
+    for (; i < nEnd; ++i)
+    {
+        if (pabyBitmap[i / 8] & (1 << (i % 8)))
+            return false;
+    }
+    return true;
+}
 
-    if (osEncoding == "geoarrow.multilinestring")
+template <class NonNullFunc, class NullFunc>
+static void ForEachMaybeNull(const arrow::Array *values,
+                             const size_t nIdxStart, const size_t nCount,
+                             NonNullFunc nonNull, NullFunc isNull)
+{
+    if (values->null_count() == 0)
+    {
+        for (size_t k = 0; k < nCount; k++)
+            nonNull(k);
+        return;
+    }
+    const uint8_t *pabyValidity = values->null_bitmap_data();
+    const size_t nOffset = static_cast<size_t>(values->offset()) + nIdxStart;
+    // For long ranges of an array that does contain nulls elsewhere, it
+    // is still frequent that the range itself is homogeneous: answer
+    // that with a bytewise bitmap scan and run a test-free loop. Not
+    // worth the extra pass for short ranges.
+    if (nCount >= 64)
     {
-        if (!IsListOfPointType(fieldType, 2, bHasZ, bHasM))
+        if (IsBitRangeAllSet(pabyValidity, nOffset, nCount))
         {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Geometry column %s has a type != list<vertices: "
-                     "fixed_size_list<xy: double>[2]>>: %s. "
-                     "Handling it as a regular field",
-                     fieldName.c_str(), fieldType->name().c_str());
-            return false;
+            for (size_t k = 0; k < nCount; k++)
+                nonNull(k);
+            return;
+        }
+        if (IsBitRangeAllUnset(pabyValidity, nOffset, nCount))
+        {
+            for (size_t k = 0; k < nCount; k++)
+                isNull(k);
+            return;
         }
-        eGeomTypeOut =
-            OGR_GT_SetModifier(wkbMultiLineString, static_cast<int>(bHasZ),
-                               static_cast<int>(bHasM));
-        eOGRArrowGeomEncodingOut =
-            OGRArrowGeomEncoding::GEOARROW_MULTILINESTRING;
-        return true;
     }
-
-    if (osEncoding == "geoarrow.multipolygon")
+    for (size_t k = 0; k < nCount; k++)
     {
-        if (!IsListOfPointType(fieldType, 3, bHasZ, bHasM))
+        const size_t nBit = nOffset + k;
+        if ((nBit % 8) == 0 && k + 8 <= nCount)
         {
-            CPLError(
-                CE_Warning, CPLE_AppDefined,
-                "Geometry column %s has a type != list<polygons: list<rings: "
-                "list<vertices: fixed_size_list<xy: double>[2]>>>: %s. "
-                "Handling it as a regular field",
-                fieldName.c_str(), fieldType->name().c_str());
-            return false;
+            const uint8_t byValidity = pabyValidity[nBit / 8];
+            if (byValidity == 0)
+            {
+                for (size_t j = 0; j < 8; j++)
+                    isNull(k + j);
+                k += 7;
+                continue;
+            }
+            else if (byValidity == 0xFF)
+            {
+                for (size_t j = 0; j < 8; j++)
+                    nonNull(k + j);
+                k += 7;
+                continue;
+            }
         }
-        eGeomTypeOut = OGR_GT_SetModifier(
-            wkbMultiPolygon, static_cast<int>(bHasZ), static_cast<int>(bHasM));
-        eOGRArrowGeomEncodingOut = OGRArrowGeomEncoding::GEOARROW_MULTIPOLYGON;
-        return true;
+        if (pabyValidity[nBit / 8] & (1 << (nBit % 8)))
+            nonNull(k);
+        else
+            isNull(k);
     }
-
-    CPLError(CE_Warning, CPLE_AppDefined,
-             "Geometry column %s uses a unhandled encoding: %s. "
-             "Handling it as a regular field",
-             fieldName.c_str(), osEncoding.c_str());
-    return false;
 }
 
 /************************************************************************/
-/*                    GetGeometryTypeFromString()                       */
+/*                         WriteRangeAsJSON()                           */
 /************************************************************************/
 
-inline OGRwkbGeometryType
-OGRArrowLayer::GetGeometryTypeFromString(const std::string &osType)
+template <class ArrayType, class OutType>
+static void WriteNumericRangeAsJSON(CPLJSonStreamingWriter &oWriter,
+                                    const arrow::Array *values,
+                                    const size_t nIdxStart, const size_t nCount)
 {
-    OGRwkbGeometryType eGeomType = wkbUnknown;
-    OGRReadWKTGeometryType(osType.c_str(), &eGeomType);
-    if (eGeomType == wkbUnknown && !osType.empty())
-    {
-        CPLDebug("ARROW", "Unknown geometry type: %s", osType.c_str());
-    }
-    return eGeomType;
+    const auto typedValues = static_cast<const ArrayType *>(values);
+    ForEachMaybeNull(
+        values, nIdxStart, nCount,
+        [&oWriter, typedValues, nIdxStart](const size_t k) {
+            oWriter.Add(
+                static_cast<OutType>(typedValues->Value(nIdxStart + k)));
+        },
+        [&oWriter](size_t) { oWriter.AddNull(); });
 }
 
-static CPLJSONObject GetObjectAsJSON(const arrow::Array *array,
-                                     const size_t nIdx);
+template <class ArrayType>
+static void WriteStringRangeAsJSON(CPLJSonStreamingWriter &oWriter,
+                                   const arrow::Array *values,
+                                   const size_t nIdxStart, const size_t nCount)
+{
+    const auto typedValues = static_cast<const ArrayType *>(values);
+    // Scratch string reused across elements: GetView() points into the
+    // value buffer, so this avoids the per-element heap allocation that
+    // the std::string returned by GetString() would do.
+    std::string osTmp;
+    ForEachMaybeNull(
+        values, nIdxStart, nCount,
+        [&oWriter, &osTmp, typedValues, nIdxStart](const size_t k)
+        {
+            const auto sv = typedValues->GetView(nIdxStart + k);
+            osTmp.assign(sv.data(), sv.size());
+            oWriter.Add(osTmp);
+        },
+        [&oWriter](size_t) { oWriter.AddNull(); });
+}
 
-/************************************************************************/
-/*                               AddToArray()                           */
-/************************************************************************/
+template <class ArrayType>
+static void WriteDecimalRangeAsJSON(CPLJSonStreamingWriter &oWriter,
+                                    const arrow::Array *values,
+                                    const size_t nIdxStart, const size_t nCount)
+{
+    const auto typedValues = static_cast<const ArrayType *>(values);
+    const int32_t nScale = GetDecimalScale(values);
+    ForEachMaybeNull(
+        values, nIdxStart, nCount,
+        [&oWriter, typedValues, nIdxStart, nScale](const size_t k) {
+            oWriter.Add(
+                GetDecimalAsDouble(typedValues, nIdxStart + k, nScale));
+        },
+        [&oWriter](size_t) { oWriter.AddNull(); });
+}
 
-static void AddToArray(CPLJSONArray &oArray, const arrow::Array *array,
-                       const size_t nIdx)
+// Serialize values[nIdxStart, nIdxStart + nCount) into oWriter, resolving
+// the value type once for the whole range rather than re-dispatching on it
+// for each element.
+static void WriteRangeAsJSON(CPLJSonStreamingWriter &oWriter,
+                             const arrow::Array *values,
+                             const size_t nIdxStart, const size_t nCount)
 {
-    switch (array->type()->id())
+    switch (values->type()->id())
     {
         case arrow::Type::BOOL:
         {
-            oArray.Add(
-                static_cast<const arrow::BooleanArray *>(array)->Value(nIdx));
+            WriteNumericRangeAsJSON<arrow::BooleanArray, bool>(
+                oWriter, values, nIdxStart, nCount);
             break;
         }
         case arrow::Type::UINT8:
         {
-            oArray.Add(
-                static_cast<const arrow::UInt8Array *>(array)->Value(nIdx));
+            WriteNumericRangeAsJSON<arrow::UInt8Array, int>(oWriter, values,
+                                                            nIdxStart, nCount);
             break;
         }
         case arrow::Type::INT8:
         {
-            oArray.Add(
-                static_cast<const arrow::Int8Array *>(array)->Value(nIdx));
+            WriteNumericRangeAsJSON<arrow::Int8Array, int>(oWriter, values,
+                                                           nIdxStart, nCount);
             break;
         }
         case arrow::Type::UINT16:
         {
-            oArray.Add(
-                static_cast<const arrow::UInt16Array *>(array)->Value(nIdx));
+            WriteNumericRangeAsJSON<arrow::UInt16Array, int>(oWriter, values,
+                                                             nIdxStart, nCount);
             break;
         }
         case arrow::Type::INT16:
         {
-            oArray.Add(
-                static_cast<const arrow::Int16Array *>(array)->Value(nIdx));
+            WriteNumericRangeAsJSON<arrow::Int16Array, int>(oWriter, values,
+                                                            nIdxStart, nCount);
             break;
         }
         case arrow::Type::INT32:
         {
-            oArray.Add(
-                static_cast<const arrow::Int32Array *>(array)->Value(nIdx));
+            WriteNumericRangeAsJSON<arrow::Int32Array, int>(oWriter, values,
+                                                            nIdxStart, nCount);
             break;
         }
         case arrow::Type::UINT32:
         {
-            oArray.Add(static_cast<GInt64>(
-                static_cast<const arrow::UInt32Array *>(array)->Value(nIdx)));
+            WriteNumericRangeAsJSON<arrow::UInt32Array, std::int64_t>(
+                oWriter, values, nIdxStart, nCount);
             break;
         }
         case arrow::Type::INT64:
         {
-            oArray.Add(static_cast<GInt64>(
-                static_cast<const arrow::Int64Array *>(array)->Value(nIdx)));
+            WriteNumericRangeAsJSON<arrow::Int64Array, std::int64_t>(
+                oWriter, values, nIdxStart, nCount);
             break;
         }
         case arrow::Type::UINT64:
         {
-            oArray.Add(static_cast<uint64_t>(
-                static_cast<const arrow::UInt64Array *>(array)->Value(nIdx)));
+            WriteNumericRangeAsJSON<arrow::UInt64Array, std::uint64_t>(
+                oWriter, values, nIdxStart, nCount);
             break;
         }
         case arrow::Type::HALF_FLOAT:
         {
-            const uint16_t nFloat16 =
-                static_cast<const arrow::HalfFloatArray *>(array)->Value(nIdx);
-            uint32_t nFloat32 = CPLHalfToFloat(nFloat16);
-            float f;
-            memcpy(&f, &nFloat32, sizeof(nFloat32));
-            oArray.Add(f);
+            const auto typedValues =
+                static_cast<const arrow::HalfFloatArray *>(values);
+            const uint16_t *panRawValues = typedValues->raw_values();
+            ForEachMaybeNull(
+                values, nIdxStart, nCount,
+                [&oWriter, panRawValues, nIdxStart](const size_t k) {
+                    oWriter.Add(
+                        GetHalfFloatValue(panRawValues[nIdxStart + k]));
+                },
+                [&oWriter](size_t) { oWriter.AddNull(); });
             break;
         }
         case arrow::Type::FLOAT:
         {
-            oArray.Add(
-                static_cast<const arrow::FloatArray *>(array)->Value(nIdx));
+            WriteNumericRangeAsJSON<arrow::FloatArray, double>(
+                oWriter, values, nIdxStart, nCount);
             break;
         }
         case arrow::Type::DOUBLE:
         {
-            oArray.Add(
-                static_cast<const arrow::DoubleArray *>(array)->Value(nIdx));
+            WriteNumericRangeAsJSON<arrow::DoubleArray, double>(
+                oWriter, values, nIdxStart, nCount);
             break;
         }
         case arrow::Type::DECIMAL128:
         {
-            oArray.Add(
-                CPLAtof(static_cast<const arrow::Decimal128Array *>(array)
-                            ->FormatValue(nIdx)
-                            .c_str()));
+            WriteDecimalRangeAsJSON<arrow::Decimal128Array>(oWriter, values,
+                                                            nIdxStart, nCount);
             break;
         }
         case arrow::Type::DECIMAL256:
         {
-            oArray.Add(
-                CPLAtof(static_cast<const arrow::Decimal256Array *>(array)
-                            ->FormatValue(nIdx)
-                            .c_str()));
+            WriteDecimalRangeAsJSON<arrow::Decimal256Array>(oWriter, values,
+                                                            nIdxStart, nCount);
             break;
         }
         case arrow::Type::STRING:
         {
-            oArray.Add(
-                static_cast<const arrow::StringArray *>(array)->GetString(
-                    nIdx));
+            WriteStringRangeAsJSON<arrow::StringArray>(oWriter, values,
+                                                       nIdxStart, nCount);
             break;
         }
         case arrow::Type::LARGE_STRING:
         {
-            oArray.Add(
-                static_cast<const arrow::LargeStringArray *>(array)->GetString(
-                    nIdx));
+            WriteStringRangeAsJSON<arrow::LargeStringArray>(oWriter, values,
+                                                            nIdxStart, nCount);
             break;
         }
         case arrow::Type::LIST:
@@ -1079,167 +1587,152 @@ static void AddToArray(CPLJSONArray &oArray, const arrow::Array *array,
         case arrow::Type::MAP:
         case arrow::Type::STRUCT:
         {
-            oArray.Add(GetObjectAsJSON(array, nIdx));
+            ForEachMaybeNull(
+                values, nIdxStart, nCount,
+                [&oWriter, values, nIdxStart](const size_t k)
+                { WriteObjectAsJSON(oWriter, values, nIdxStart + k); },
+                [&oWriter](size_t) { oWriter.AddNull(); });
             break;
         }
 
         default:
         {
-            CPLDebug("ARROW", "AddToArray(): unexpected data type %s",
-                     array->type()->ToString().c_str());
+            CPLDebug("ARROW", "WriteRangeAsJSON(): unexpected data type %s",
+                     values->type()->ToString().c_str());
             break;
         }
     }
 }
 
 /************************************************************************/
-/*                         GetListAsJSON()                              */
+/*                         WriteListAsJSON()                            */
 /************************************************************************/
 
 template <class ArrowType>
-static CPLJSONObject GetListAsJSON(const ArrowType *array,
-                                   const size_t nIdxInArray)
+static void WriteListAsJSON(CPLJSonStreamingWriter &oWriter,
+                            const ArrowType *array, const size_t nIdxInArray)
 {
-    const auto values = std::static_pointer_cast<ArrowType>(array->values());
+    const auto values = array->values();
     const auto nIdxStart = array->value_offset(nIdxInArray);
     const auto nCount = array->value_length(nIdxInArray);
-    CPLJSONArray oArray;
-    for (auto k = decltype(nCount){0}; k < nCount; k++)
-    {
-        if (values->IsNull(nIdxStart + k))
-            oArray.AddNull();
-        else
-            AddToArray(oArray, values.get(), nIdxStart + k);
-    }
-    return oArray;
+    oWriter.StartArray();
+    WriteRangeAsJSON(oWriter, values.get(), static_cast<size_t>(nIdxStart),
+                     static_cast<size_t>(nCount));
+    oWriter.EndArray();
 }
 
 /************************************************************************/
-/*                              AddToDict()                             */
+/*                         WriteValueAsJSON()                           */
 /************************************************************************/
 
-static void AddToDict(CPLJSONObject &oDict, const std::string &osKey,
-                      const arrow::Array *array, const size_t nIdx)
+// Serialize the single element array[nIdx] into oWriter, as the value of
+// an object key already emitted by the caller.
+static void WriteValueAsJSON(CPLJSonStreamingWriter &oWriter,
+                             const arrow::Array *array, const size_t nIdx)
 {
     switch (array->type()->id())
     {
         case arrow::Type::BOOL:
         {
-            oDict.Add(
-                osKey,
+            oWriter.Add(
                 static_cast<const arrow::BooleanArray *>(array)->Value(nIdx));
             break;
         }
         case arrow::Type::UINT8:
         {
-            oDict.Add(
-                osKey,
+            oWriter.Add(
                 static_cast<const arrow::UInt8Array *>(array)->Value(nIdx));
             break;
         }
         case arrow::Type::INT8:
         {
-            oDict.Add(
-                osKey,
+            oWriter.Add(
                 static_cast<const arrow::Int8Array *>(array)->Value(nIdx));
             break;
         }
         case arrow::Type::UINT16:
         {
-            oDict.Add(
-                osKey,
+            oWriter.Add(
                 static_cast<const arrow::UInt16Array *>(array)->Value(nIdx));
             break;
         }
         case arrow::Type::INT16:
         {
-            oDict.Add(
-                osKey,
+            oWriter.Add(
                 static_cast<const arrow::Int16Array *>(array)->Value(nIdx));
             break;
         }
         case arrow::Type::INT32:
         {
-            oDict.Add(
-                osKey,
+            oWriter.Add(
                 static_cast<const arrow::Int32Array *>(array)->Value(nIdx));
             break;
         }
         case arrow::Type::UINT32:
         {
-            oDict.Add(osKey,
-                      static_cast<GInt64>(
-                          static_cast<const arrow::UInt32Array *>(array)->Value(
-                              nIdx)));
+            oWriter.Add(static_cast<std::int64_t>(
+                static_cast<const arrow::UInt32Array *>(array)->Value(nIdx)));
             break;
         }
         case arrow::Type::INT64:
         {
-            oDict.Add(osKey,
-                      static_cast<GInt64>(
-                          static_cast<const arrow::Int64Array *>(array)->Value(
-                              nIdx)));
+            oWriter.Add(static_cast<std::int64_t>(
+                static_cast<const arrow::Int64Array *>(array)->Value(nIdx)));
             break;
         }
         case arrow::Type::UINT64:
         {
-            oDict.Add(osKey,
-                      static_cast<uint64_t>(
-                          static_cast<const arrow::UInt64Array *>(array)->Value(
-                              nIdx)));
+            oWriter.Add(static_cast<std::uint64_t>(
+                static_cast<const arrow::UInt64Array *>(array)->Value(nIdx)));
             break;
         }
         case arrow::Type::HALF_FLOAT:
         {
-            const uint16_t nFloat16 =
-                static_cast<const arrow::HalfFloatArray *>(array)->Value(nIdx);
-            uint32_t nFloat32 = CPLHalfToFloat(nFloat16);
-            float f;
-            memcpy(&f, &nFloat32, sizeof(nFloat32));
-            oDict.Add(osKey, f);
+            oWriter.Add(GetHalfFloatValue(
+                static_cast<const arrow::HalfFloatArray *>(array)->Value(
+                    nIdx)));
             break;
         }
         case arrow::Type::FLOAT:
         {
-            oDict.Add(
-                osKey,
-                static_cast<const arrow::FloatArray *>(array)->Value(nIdx));
+            oWriter.Add(static_cast<double>(
+                static_cast<const arrow::FloatArray *>(array)->Value(nIdx)));
             break;
         }
         case arrow::Type::DOUBLE:
         {
-            oDict.Add(
-                osKey,
+            oWriter.Add(
                 static_cast<const arrow::DoubleArray *>(array)->Value(nIdx));
             break;
         }
         case arrow::Type::DECIMAL128:
         {
-            oDict.Add(osKey,
-                      CPLAtof(static_cast<const arrow::Decimal128Array *>(array)
-                                  ->FormatValue(nIdx)
-                                  .c_str()));
+            const auto typedArray =
+                static_cast<const arrow::Decimal128Array *>(array);
+            oWriter.Add(
+                GetDecimalAsDouble(typedArray, nIdx, GetDecimalScale(array)));
             break;
         }
         case arrow::Type::DECIMAL256:
         {
-            oDict.Add(osKey,
-                      CPLAtof(static_cast<const arrow::Decimal256Array *>(array)
-                                  ->FormatValue(nIdx)
-                                  .c_str()));
+            const auto typedArray =
+                static_cast<const arrow::Decimal256Array *>(array);
+            oWriter.Add(
+                GetDecimalAsDouble(typedArray, nIdx, GetDecimalScale(array)));
             break;
         }
         case arrow::Type::STRING:
         {
-            oDict.Add(osKey,
-                      static_cast<const arrow::StringArray *>(array)->GetString(
-                          nIdx));
+            oWriter.Add(
+                static_cast<const arrow::StringArray *>(array)->GetString(
+                    nIdx));
             break;
         }
         case arrow::Type::LARGE_STRING:
         {
-            oDict.Add(osKey, static_cast<const arrow::LargeStringArray *>(array)
-                                 ->GetString(nIdx));
+            oWriter.Add(
+                static_cast<const arrow::LargeStringArray *>(array)->GetString(
+                    nIdx));
             break;
         }
         case arrow::Type::LIST:
@@ -1248,101 +1741,117 @@ static void AddToDict(CPLJSONObject &oDict, const std::string &osKey,
         case arrow::Type::MAP:
         case arrow::Type::STRUCT:
         {
-            oDict.Add(osKey, GetObjectAsJSON(array, nIdx));
+            WriteObjectAsJSON(oWriter, array, nIdx);
             break;
         }
 
         default:
         {
-            CPLDebug("ARROW", "AddToDict(): unexpected data type %s",
+            CPLDebug("ARROW", "WriteValueAsJSON(): unexpected data type %s",
                      array->type()->ToString().c_str());
+            oWriter.AddNull();
             break;
         }
     }
 }
 
 /************************************************************************/
-/*                         GetMapAsJSON()                               */
+/*                          WriteMapAsJSON()                            */
 /************************************************************************/
 
-static CPLJSONObject GetMapAsJSON(const arrow::Array *array,
-                                  const size_t nIdxInArray)
+static void WriteMapAsJSON(CPLJSonStreamingWriter &oWriter,
+                           const arrow::Array *array, const size_t nIdxInArray)
 {
     const auto mapArray = static_cast<const arrow::MapArray *>(array);
-    const auto keys =
-        std::static_pointer_cast<arrow::StringArray>(mapArray->keys());
-    const auto values = mapArray->items();
+    // Raw pointers are sufficient here: the map array keeps its children
+    // alive, and this avoids shared_ptr refcounting in the loop below.
+    const auto *keys =
+        static_cast<const arrow::StringArray *>(mapArray->keys().get());
+    const auto *values = mapArray->items().get();
     const auto nIdxStart = mapArray->value_offset(nIdxInArray);
     const int nCount = mapArray->value_length(nIdxInArray);
-    CPLJSONObject oRoot;
+    // Scratch string reused across keys, to avoid the per-key heap
+    // allocation of GetString().
+    std::string osKey;
+    oWriter.StartObj();
     for (int k = 0; k < nCount; k++)
     {
         if (!keys->IsNull(nIdxStart + k))
         {
-            const auto osKey = keys->GetString(nIdxStart + k);
+            const auto sv = keys->GetView(nIdxStart + k);
+            osKey.assign(sv.data(), sv.size());
+            oWriter.AddObjKey(osKey);
             if (!values->IsNull(nIdxStart + k))
-                AddToDict(oRoot, osKey, values.get(), nIdxStart + k);
+                WriteValueAsJSON(oWriter, values, nIdxStart + k);
             else
-                oRoot.AddNull(osKey);
+                oWriter.AddNull();
         }
     }
-    return oRoot;
+    oWriter.EndObj();
 }
 
 /************************************************************************/
-/*                        GetStructureAsJSON()                          */
+/*                       WriteStructureAsJSON()                         */
 /************************************************************************/
 
-static CPLJSONObject GetStructureAsJSON(const arrow::Array *array,
-                                        const size_t nIdxInArray)
+static void WriteStructureAsJSON(CPLJSonStreamingWriter &oWriter,
+                                 const arrow::Array *array,
+                                 const size_t nIdxInArray)
 {
-    CPLJSONObject oRoot;
     const auto structArray = static_cast<const arrow::StructArray *>(array);
     const auto structArrayType = structArray->type();
+    oWriter.StartObj();
     for (int i = 0; i < structArrayType->num_fields(); ++i)
     {
         const auto field = structArray->field(i);
+        oWriter.AddObjKey(structArrayType->field(i)->name());
         if (!field->IsNull(nIdxInArray))
-        {
-            AddToDict(oRoot, structArrayType->field(i)->name(), field.get(),
-                      nIdxInArray);
-        }
+            WriteValueAsJSON(oWriter, field.get(), nIdxInArray);
         else
-            oRoot.AddNull(structArrayType->field(i)->name());
+            oWriter.AddNull();
     }
-
-    return oRoot;
+    oWriter.EndObj();
 }
 
 /************************************************************************/
-/*                        GetObjectAsJSON()                             */
+/*                        WriteObjectAsJSON()                           */
 /************************************************************************/
 
-static CPLJSONObject GetObjectAsJSON(const arrow::Array *array,
-                                     const size_t nIdxInArray)
+static void WriteObjectAsJSON(CPLJSonStreamingWriter &oWriter,
+                              const arrow::Array *array,
+                              const size_t nIdxInArray)
 {
     switch (array->type()->id())
     {
         case arrow::Type::MAP:
-            return GetMapAsJSON(array, nIdxInArray);
+            WriteMapAsJSON(oWriter, array, nIdxInArray);
+            break;
         case arrow::Type::LIST:
-            return GetListAsJSON(static_cast<const arrow::ListArray *>(array),
-                                 nIdxInArray);
+            WriteListAsJSON(oWriter,
+                            static_cast<const arrow::ListArray *>(array),
+                            nIdxInArray);
+            break;
         case arrow::Type::LARGE_LIST:
-            return GetListAsJSON(
-                static_cast<const arrow::LargeListArray *>(array), nIdxInArray);
+            WriteListAsJSON(oWriter,
+                            static_cast<const arrow::LargeListArray *>(array),
+                            nIdxInArray);
+            break;
         case arrow::Type::FIXED_SIZE_LIST:
-            return GetListAsJSON(
-                static_cast<const arrow::FixedSizeListArray *>(array),
+            WriteListAsJSON(
+                oWriter, static_cast<const arrow::FixedSizeListArray *>(array),
                 nIdxInArray);
+            break;
         case arrow::Type::STRUCT:
-            return GetStructureAsJSON(array, nIdxInArray);
+            WriteStructureAsJSON(oWriter, array, nIdxInArray);
+            break;
         default:
         {
             CPLError(CE_Failure, CPLE_AppDefined,
-                     "GetObjectAsJSON(): unhandled value format: %s",
+                     "WriteObjectAsJSON(): unhandled value format: %s",
                      array->type()->ToString().c_str());
-            return CPLJSONObject();
+            // Still emit a value so that the writer state stays consistent.
+            oWriter.AddNull();
+            break;
         }
     }
 }
@@ -1351,7 +1860,10 @@ template <class OGRType, class ArrowType, class ArrayType>
 static void ReadList(OGRFeature *poFeature, int i, int64_t nIdxInArray,
                      const ArrayType *array)
 {
-    const auto values = std::static_pointer_cast<ArrowType>(array->values());
+    // The list array keeps its values child alive: use a raw pointer to
+    // avoid shared_ptr refcounting around the loop.
+    const auto *values =
+        static_cast<const ArrowType *>(array->values().get());
     const auto nIdxStart = array->value_offset(nIdxInArray);
     const int nCount = array->value_length(nIdxInArray);
     std::vector<OGRType> aValues;
@@ -1363,215 +1875,633 @@ static void ReadList(OGRFeature *poFeature, int i, int64_t nIdxInArray,
     poFeature->SetField(i, nCount, aValues.data());
 }
 
-template <class ArrowType, class ArrayType>
-static void ReadListDouble(OGRFeature *poFeature, int i, int64_t nIdxInArray,
-                           const ArrayType *array)
+// Convert one raw element of ArrowType's storage to double. The generic
+// version is a plain widening; half-float storage needs a decode of the
+// 16-bit pattern.
+template <class ArrowType>
+static double CoerceToDouble(const typename ArrowType::TypeClass::c_type v)
 {
-    const auto values = std::static_pointer_cast<ArrowType>(array->values());
-    const auto rawValues = values->raw_values();
-    const auto nIdxStart = array->value_offset(nIdxInArray);
-    const int nCount = array->value_length(nIdxInArray);
-    std::vector<double> aValues;
-    aValues.reserve(nCount);
-    for (int k = 0; k < nCount; k++)
-    {
-        if (values->IsNull(nIdxStart + k))
-            aValues.push_back(std::numeric_limits<double>::quiet_NaN());
-        else
-            aValues.push_back(rawValues[nIdxStart + k]);
+    return static_cast<double>(v);
+}
+
+template <>
+double CoerceToDouble<arrow::HalfFloatArray>(const uint16_t v)
+{
+    return GetHalfFloatValue(v);
+}
+
+// Install a list of doubles coming from a contiguous double buffer
+// without copying it.
+static void SetFieldDoubleList(OGRFeature *poFeature, int i, int nCount,
+                               const double *padfValues)
+{
+    poFeature->SetField(i, nCount, padfValues);
+}
+
+// Float variant: a conversion copy is unavoidable, but it runs as a tight
+// loop without per-element null tests.
+static void SetFieldDoubleList(OGRFeature *poFeature, int i, int nCount,
+                               const float *pafValues)
+{
+    std::vector<double> aValues(pafValues, pafValues + nCount);
+    poFeature->SetField(i, nCount, aValues.data());
+}
+
+// Half-float variant: same as the float one, with a decode per element.
+static void SetFieldDoubleList(OGRFeature *poFeature, int i, int nCount,
+                               const uint16_t *panValues)
+{
+    std::vector<double> aValues;
+    aValues.reserve(nCount);
+    for (int k = 0; k < nCount; k++)
+        aValues.push_back(GetHalfFloatValue(panValues[k]));
+    poFeature->SetField(i, nCount, aValues.data());
+}
+
+template <class ArrowType, class ArrayType>
+static void ReadListDouble(OGRFeature *poFeature, int i, int64_t nIdxInArray,
+                           const ArrayType *array)
+{
+    const auto *values =
+        static_cast<const ArrowType *>(array->values().get());
+    const auto rawValues = values->raw_values();
+    const auto nIdxStart = array->value_offset(nIdxInArray);
+    const int nCount = array->value_length(nIdxInArray);
+    if (values->null_count() == 0)
+    {
+        // No nulls anywhere in the values array: the raw buffer can be
+        // used as is, skipping the per-element null test (and, for
+        // double values, the staging copy).
+        SetFieldDoubleList(poFeature, i, nCount, rawValues + nIdxStart);
+        return;
     }
+    std::vector<double> aValues;
+    aValues.reserve(nCount);
+    ForEachMaybeNull(
+        values, static_cast<size_t>(nIdxStart), static_cast<size_t>(nCount),
+        [&aValues, rawValues, nIdxStart](const size_t k) {
+            aValues.push_back(
+                CoerceToDouble<ArrowType>(rawValues[nIdxStart + k]));
+        },
+        [&aValues](size_t)
+        { aValues.push_back(std::numeric_limits<double>::quiet_NaN()); });
     poFeature->SetField(i, nCount, aValues.data());
 }
 
+// Specialized path for lists of int32: the source buffer already has the
+// layout OGRFeature::SetField() expects, so no staging vector is needed.
 template <class ArrayType>
-static void ReadList(OGRFeature *poFeature, int i, int64_t nIdxInArray,
-                     const ArrayType *array, arrow::Type::type valueTypeId)
+static void ReadListInt32(OGRFeature *poFeature, int i, int64_t nIdxInArray,
+                          const ArrayType *array)
+{
+    const auto *values =
+        static_cast<const arrow::Int32Array *>(array->values().get());
+    const auto nIdxStart = array->value_offset(nIdxInArray);
+    const int nCount = array->value_length(nIdxInArray);
+    poFeature->SetField(i, nCount, values->raw_values() + nIdxStart);
+}
+
+typedef void (*ArrowFieldReaderType)(OGRFeature *, int, int64_t,
+                                     const arrow::Array *);
+
+// Thin type-erased wrappers around the typed list readers, so that a
+// resolved reader can be stored and called through a plain function
+// pointer.
+
+template <class OGRType, class ArrowType, class ArrayType>
+static void ReadListGeneric(OGRFeature *poFeature, int i, int64_t nIdxInArray,
+                            const arrow::Array *array)
+{
+    ReadList<OGRType, ArrowType>(poFeature, i, nIdxInArray,
+                                 static_cast<const ArrayType *>(array));
+}
+
+template <class ArrayType>
+static void ReadListInt32Erased(OGRFeature *poFeature, int i,
+                                int64_t nIdxInArray, const arrow::Array *array)
+{
+    ReadListInt32(poFeature, i, nIdxInArray,
+                  static_cast<const ArrayType *>(array));
+}
+
+template <class ArrowType, class ArrayType>
+static void ReadListDoubleErased(OGRFeature *poFeature, int i,
+                                 int64_t nIdxInArray, const arrow::Array *array)
+{
+    ReadListDouble<ArrowType>(poFeature, i, nIdxInArray,
+                              static_cast<const ArrayType *>(array));
+}
+
+template <class DecimalArrayType, class ArrayType>
+static void ReadListDecimal(OGRFeature *poFeature, int i, int64_t nIdxInArray,
+                            const arrow::Array *arrayIn)
+{
+    const auto array = static_cast<const ArrayType *>(arrayIn);
+    const auto *values =
+        static_cast<const DecimalArrayType *>(array->values().get());
+    const auto nIdxStart = array->value_offset(nIdxInArray);
+    const int nCount = array->value_length(nIdxInArray);
+    const int32_t nScale = GetDecimalScale(values);
+    std::vector<double> aValues;
+    aValues.reserve(nCount);
+    ForEachMaybeNull(
+        values, static_cast<size_t>(nIdxStart), static_cast<size_t>(nCount),
+        [&aValues, values, nIdxStart, nScale](const size_t k) {
+            aValues.push_back(
+                GetDecimalAsDouble(values, nIdxStart + k, nScale));
+        },
+        [&aValues](size_t)
+        { aValues.push_back(std::numeric_limits<double>::quiet_NaN()); });
+    poFeature->SetField(i, nCount, aValues.data());
+}
+
+template <class StringArrayType, class ArrayType>
+static void ReadListString(OGRFeature *poFeature, int i, int64_t nIdxInArray,
+                           const arrow::Array *arrayIn)
+{
+    const auto array = static_cast<const ArrayType *>(arrayIn);
+    const auto *values =
+        static_cast<const StringArrayType *>(array->values().get());
+    const auto nIdxStart = array->value_offset(nIdxInArray);
+    const auto nCount = array->value_length(nIdxInArray);
+    // Build the NULL-terminated list directly from the value buffer, with
+    // a single allocation of the pointer array and one per string, instead
+    // of going through CPLStringList::AddString() (which reallocates the
+    // pointer array and does a strlen() per element) and the std::string
+    // temporary of GetString().
+    const auto *panOffsets = values->raw_value_offsets() + nIdxStart;
+    const char *pachData = reinterpret_cast<const char *>(values->raw_data());
+    // Copy all the strings of the list into a single NUL-separated buffer
+    // and point the list entries into it: one allocation for the whole
+    // list instead of one per string. SetField() copies the list, so
+    // local storage is fine. The reserve() below is an upper bound of
+    // what gets appended, so abyBuf never reallocates and the stored
+    // pointers stay valid.
+    std::vector<char> abyBuf;
+    abyBuf.reserve(static_cast<size_t>(panOffsets[nCount] - panOffsets[0]) +
+                   static_cast<size_t>(nCount));
+    std::vector<char *> apszList(static_cast<size_t>(nCount) + 1);
+    ForEachMaybeNull(
+        values, static_cast<size_t>(nIdxStart), static_cast<size_t>(nCount),
+        [&abyBuf, &apszList, panOffsets, pachData](const size_t k)
+        {
+            apszList[k] = abyBuf.data() + abyBuf.size();
+            abyBuf.insert(abyBuf.end(), pachData + panOffsets[k],
+                          pachData + panOffsets[k + 1]);
+            abyBuf.push_back(0);
+        },
+        [&abyBuf, &apszList](const size_t k)
+        {
+            // we cannot have null strings in a list
+            apszList[k] = abyBuf.data() + abyBuf.size();
+            abyBuf.push_back(0);
+        });
+    apszList[nCount] = nullptr;
+    poFeature->SetField(i, apszList.data());
+}
+
+template <class ArrayType>
+static void ReadListAsJSON(OGRFeature *poFeature, int i, int64_t nIdxInArray,
+                           const arrow::Array *arrayIn)
+{
+    const auto array = static_cast<const ArrayType *>(arrayIn);
+    // Serialize directly to a string, without building an intermediate
+    // CPLJSONObject tree and formatting it afterwards.
+    CPLJSonStreamingWriter oWriter(nullptr, nullptr);
+    oWriter.SetPrettyFormatting(false);
+    // Rough guess of the serialized size, to avoid the first rounds of
+    // string reallocation.
+    oWriter.Reserve(
+        8 * static_cast<size_t>(array->value_length(nIdxInArray)) + 2);
+    WriteListAsJSON(oWriter, array, static_cast<size_t>(nIdxInArray));
+    poFeature->SetField(i, oWriter.GetString().c_str());
+}
+
+// No-op reader cached for unhandled types, so the resolution (and its
+// warning or debug message) runs only once per field.
+static void ReadFieldNothing(OGRFeature *, int, int64_t, const arrow::Array *)
+{
+}
+
+/************************************************************************/
+/*                          GetReadListFunc()                           */
+/************************************************************************/
+
+// Resolve the function reading a list of the given value type into an OGR
+// field. The value type of a column does not change during a scan, so the
+// result can be cached per field and called directly for each feature,
+// instead of re-dispatching on the value type every time.
+template <class ArrayType>
+static ArrowFieldReaderType GetReadListFunc(arrow::Type::type valueTypeId)
 {
     switch (valueTypeId)
     {
         case arrow::Type::BOOL:
-        {
-            ReadList<int, arrow::BooleanArray>(poFeature, i, nIdxInArray,
-                                               array);
-            break;
-        }
+            return ReadListGeneric<int, arrow::BooleanArray, ArrayType>;
         case arrow::Type::UINT8:
-        {
-            ReadList<int, arrow::UInt8Array>(poFeature, i, nIdxInArray, array);
-            break;
-        }
+            return ReadListGeneric<int, arrow::UInt8Array, ArrayType>;
         case arrow::Type::INT8:
-        {
-            ReadList<int, arrow::Int8Array>(poFeature, i, nIdxInArray, array);
-            break;
-        }
+            return ReadListGeneric<int, arrow::Int8Array, ArrayType>;
         case arrow::Type::UINT16:
-        {
-            ReadList<int, arrow::UInt16Array>(poFeature, i, nIdxInArray, array);
-            break;
-        }
+            return ReadListGeneric<int, arrow::UInt16Array, ArrayType>;
         case arrow::Type::INT16:
-        {
-            ReadList<int, arrow::Int16Array>(poFeature, i, nIdxInArray, array);
-            break;
-        }
+            return ReadListGeneric<int, arrow::Int16Array, ArrayType>;
         case arrow::Type::INT32:
-        {
-            ReadList<int, arrow::Int32Array>(poFeature, i, nIdxInArray, array);
-            break;
-        }
+            return ReadListInt32Erased<ArrayType>;
         case arrow::Type::UINT32:
-        {
-            ReadList<GIntBig, arrow::UInt32Array>(poFeature, i, nIdxInArray,
-                                                  array);
-            break;
-        }
+            return ReadListGeneric<GIntBig, arrow::UInt32Array, ArrayType>;
         case arrow::Type::INT64:
-        {
-            ReadList<GIntBig, arrow::Int64Array>(poFeature, i, nIdxInArray,
-                                                 array);
-            break;
-        }
+            return ReadListGeneric<GIntBig, arrow::Int64Array, ArrayType>;
         case arrow::Type::UINT64:
-        {
-            ReadList<double, arrow::UInt64Array>(poFeature, i, nIdxInArray,
-                                                 array);
-            break;
-        }
+            return ReadListGeneric<double, arrow::UInt64Array, ArrayType>;
         case arrow::Type::HALF_FLOAT:
-        {
-            const auto values = std::static_pointer_cast<arrow::HalfFloatArray>(
-                array->values());
-            const auto nIdxStart = array->value_offset(nIdxInArray);
-            const int nCount = array->value_length(nIdxInArray);
-            std::vector<double> aValues;
-            aValues.reserve(nCount);
-            for (int k = 0; k < nCount; k++)
-            {
-                if (values->IsNull(nIdxStart + k))
-                    aValues.push_back(std::numeric_limits<double>::quiet_NaN());
-                else
-                {
-                    const uint16_t nFloat16 = values->Value(nIdxStart + k);
-                    uint32_t nFloat32 = CPLHalfToFloat(nFloat16);
-                    float f;
-                    memcpy(&f, &nFloat32, sizeof(nFloat32));
-                    aValues.push_back(f);
-                }
-            }
-            poFeature->SetField(i, nCount, aValues.data());
-            break;
-        }
+            return ReadListDoubleErased<arrow::HalfFloatArray, ArrayType>;
         case arrow::Type::FLOAT:
-        {
-            ReadListDouble<arrow::FloatArray>(poFeature, i, nIdxInArray, array);
-            break;
-        }
+            return ReadListDoubleErased<arrow::FloatArray, ArrayType>;
         case arrow::Type::DOUBLE:
-        {
-            ReadListDouble<arrow::DoubleArray>(poFeature, i, nIdxInArray,
-                                               array);
-            break;
-        }
-
+            return ReadListDoubleErased<arrow::DoubleArray, ArrayType>;
         case arrow::Type::DECIMAL128:
+            return ReadListDecimal<arrow::Decimal128Array, ArrayType>;
+        case arrow::Type::DECIMAL256:
+            return ReadListDecimal<arrow::Decimal256Array, ArrayType>;
+        case arrow::Type::STRING:
+            return ReadListString<arrow::StringArray, ArrayType>;
+        case arrow::Type::LARGE_STRING:
+            return ReadListString<arrow::LargeStringArray, ArrayType>;
+        case arrow::Type::LIST:
+        case arrow::Type::LARGE_LIST:
+        case arrow::Type::FIXED_SIZE_LIST:
+        case arrow::Type::MAP:
+        case arrow::Type::STRUCT:
+            return ReadListAsJSON<ArrayType>;
+        default:
+            return nullptr;
+    }
+}
+
+/************************************************************************/
+/*                       GetArrowFieldReader()                          */
+/************************************************************************/
+
+// Per-type readers of one non-null value into an OGR field, so that the
+// type dispatch can be resolved once per field instead of once per value.
+
+template <class ArrayType, class OGRType>
+static void ReadFieldScalar(OGRFeature *poFeature, int i, int64_t nIdxInBatch,
+                            const arrow::Array *array)
+{
+    poFeature->SetFieldSameTypeUnsafe(
+        i, static_cast<OGRType>(
+               static_cast<const ArrayType *>(array)->Value(nIdxInBatch)));
+}
+
+static void ReadFieldHalfFloat(OGRFeature *poFeature, int i,
+                               int64_t nIdxInBatch, const arrow::Array *array)
+{
+    const auto castArray = static_cast<const arrow::HalfFloatArray *>(array);
+    poFeature->SetFieldSameTypeUnsafe(
+        i, GetHalfFloatValue(castArray->Value(nIdxInBatch)));
+}
+
+static void ReadFieldString(OGRFeature *poFeature, int i, int64_t nIdxInBatch,
+                            const arrow::Array *array)
+{
+    const auto castArray = static_cast<const arrow::StringArray *>(array);
+    int out_length = 0;
+    const uint8_t *data = castArray->GetValue(nIdxInBatch, &out_length);
+    char *pszString = static_cast<char *>(CPLMalloc(out_length + 1));
+    memcpy(pszString, data, out_length);
+    pszString[out_length] = 0;
+    poFeature->SetFieldSameTypeUnsafe(i, pszString);
+}
+
+static void ReadFieldBinary(OGRFeature *poFeature, int i, int64_t nIdxInBatch,
+                            const arrow::Array *array)
+{
+    const auto castArray = static_cast<const arrow::BinaryArray *>(array);
+    int out_length = 0;
+    const uint8_t *data = castArray->GetValue(nIdxInBatch, &out_length);
+    poFeature->SetField(i, out_length, data);
+}
+
+static void ReadFieldFixedSizeBinary(OGRFeature *poFeature, int i,
+                                     int64_t nIdxInBatch,
+                                     const arrow::Array *array)
+{
+    const auto castArray =
+        static_cast<const arrow::FixedSizeBinaryArray *>(array);
+    const uint8_t *data = castArray->GetValue(nIdxInBatch);
+    poFeature->SetField(i, castArray->byte_width(), data);
+}
+
+// Convert a number of seconds since Epoch into a broken-down UTC time,
+// with the constant-time days-to-civil-date algorithm of
+// http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+// (public domain). Unlike CPLUnixTimeToYMDHMS(), this resolves the year
+// and the month without looping, which matters on columns with many
+// date/time cells. Divisions are all by constants, which compilers turn
+// into multiplications by precomputed reciprocals.
+static void UnixSecondsToDateTime(int64_t nUnixTime, int &nYear, int &nMonth,
+                                  int &nDay, int &nHour, int &nMinute,
+                                  int &nSecond)
+{
+    // Floor division, so that instants before Epoch land on the right day
+    int64_t nDays = nUnixTime / 86400;
+    int nSecsInDay = static_cast<int>(nUnixTime % 86400);
+    if (nSecsInDay < 0)
+    {
+        nSecsInDay += 86400;
+        --nDays;
+    }
+    nHour = nSecsInDay / 3600;
+    nMinute = (nSecsInDay / 60) % 60;
+    nSecond = nSecsInDay % 60;
+
+    nDays += 719468;  // shift Epoch from 1970-01-01 to 0000-03-01
+    const int64_t nEra = (nDays >= 0 ? nDays : nDays - 146096) / 146097;
+    // Day within the 400-year era: [0, 146096]
+    const int nDoe = static_cast<int>(nDays - nEra * 146097);
+    // Year within the era: [0, 399]
+    const int nYoe =
+        (nDoe - nDoe / 1460 + nDoe / 36524 - nDoe / 146096) / 365;
+    // Day within the (March-based) year: [0, 365]
+    const int nDoy = nDoe - (365 * nYoe + nYoe / 4 - nYoe / 100);
+    // March-based month: [0, 11]
+    const int nMp = (5 * nDoy + 2) / 153;
+    nDay = nDoy - (153 * nMp + 2) / 5 + 1;
+    nMonth = nMp + (nMp < 10 ? 3 : -9);
+    nYear = static_cast<int>(nEra * 400 + nYoe + (nMonth <= 2 ? 1 : 0));
+}
+
+// Fill an OGRField from a timestamp already split into whole seconds
+// since Epoch and a fractional second part.
+static void FillDateTimeField(int64_t nUnixSeconds, double dfFloatingPart,
+                              int nTZFlag, OGRField *psField)
+{
+    if (nTZFlag > OGR_TZFLAG_MIXED_TZ)
+    {
+        const int TZOffset = (nTZFlag - OGR_TZFLAG_UTC) * 15;
+        nUnixSeconds += TZOffset * 60;
+    }
+    int nYear, nMonth, nDay, nHour, nMinute, nSecond;
+    UnixSecondsToDateTime(nUnixSeconds, nYear, nMonth, nDay, nHour, nMinute,
+                          nSecond);
+    psField->Date.Year = static_cast<GInt16>(nYear);
+    psField->Date.Month = static_cast<GByte>(nMonth);
+    psField->Date.Day = static_cast<GByte>(nDay);
+    psField->Date.Hour = static_cast<GByte>(nHour);
+    psField->Date.Minute = static_cast<GByte>(nMinute);
+    psField->Date.TZFlag = static_cast<GByte>(nTZFlag);
+    psField->Date.Second = static_cast<float>(nSecond + dfFloatingPart);
+}
+
+static void ReadFieldDate32(OGRFeature *poFeature, int i, int64_t nIdxInBatch,
+                            const arrow::Array *array)
+{
+    // number of days since Epoch
+    const auto castArray = static_cast<const arrow::Date32Array *>(array);
+    const int64_t timestamp =
+        static_cast<int64_t>(castArray->Value(nIdxInBatch)) * 3600 * 24;
+    int nYear, nMonth, nDay, nHour, nMinute, nSecond;
+    UnixSecondsToDateTime(timestamp, nYear, nMonth, nDay, nHour, nMinute,
+                          nSecond);
+    poFeature->SetField(i, nYear, nMonth, nDay, 0, 0, 0);
+}
+
+static void ReadFieldDate64(OGRFeature *poFeature, int i, int64_t nIdxInBatch,
+                            const arrow::Array *array)
+{
+    // number of milliseconds since Epoch
+    const auto castArray = static_cast<const arrow::Date64Array *>(array);
+    const int64_t timestamp =
+        static_cast<int64_t>(castArray->Value(nIdxInBatch)) / 1000;
+    int nYear, nMonth, nDay, nHour, nMinute, nSecond;
+    UnixSecondsToDateTime(timestamp, nYear, nMonth, nDay, nHour, nMinute,
+                          nSecond);
+    poFeature->SetField(i, nYear, nMonth, nDay, 0, 0, 0);
+}
+
+// The time unit is a template parameter, resolved once per column by
+// GetArrowFieldReader(), so the division by the unit scale is by a
+// compile-time constant.
+template <arrow::TimeUnit::type eUnit>
+static void ReadFieldTimestamp(OGRFeature *poFeature, int i,
+                               int64_t nIdxInBatch, const arrow::Array *array)
+{
+    const auto castArray = static_cast<const arrow::Int64Array *>(array);
+    int64_t timestamp = castArray->Value(nIdxInBatch);
+    OGRField sField;
+    sField.Set.nMarker1 = OGRUnsetMarker;
+    sField.Set.nMarker2 = OGRUnsetMarker;
+    sField.Set.nMarker3 = OGRUnsetMarker;
+    double floatingPart = 0;
+    if (eUnit == arrow::TimeUnit::MILLI)
+    {
+        floatingPart = (timestamp % 1000) / 1e3;
+        timestamp /= 1000;
+    }
+    else if (eUnit == arrow::TimeUnit::MICRO)
+    {
+        floatingPart = (timestamp % (1000 * 1000)) / 1e6;
+        timestamp /= 1000 * 1000;
+    }
+    else if (eUnit == arrow::TimeUnit::NANO)
+    {
+        floatingPart = (timestamp % (1000 * 1000 * 1000)) / 1e9;
+        timestamp /= 1000 * 1000 * 1000;
+    }
+    FillDateTimeField(timestamp, floatingPart,
+                      poFeature->GetFieldDefnRef(i)->GetTZFlag(), &sField);
+    poFeature->SetField(i, &sField);
+}
+
+static void ReadFieldTime32(OGRFeature *poFeature, int i, int64_t nIdxInBatch,
+                            const arrow::Array *array)
+{
+    const auto timestampType =
+        static_cast<arrow::Time32Type *>(array->data()->type.get());
+    const auto castArray = static_cast<const arrow::Int32Array *>(array);
+    const auto unit = timestampType->unit();
+    int value = castArray->Value(nIdxInBatch);
+    double floatingPart = 0;
+    if (unit == arrow::TimeUnit::MILLI)
+    {
+        floatingPart = (value % 1000) / 1e3;
+        value /= 1000;
+    }
+    const int nHour = value / 3600;
+    const int nMinute = (value / 60) % 60;
+    const int nSecond = value % 60;
+    poFeature->SetField(i, 0, 0, 0, nHour, nMinute,
+                        static_cast<float>(nSecond + floatingPart));
+}
+
+static void ReadFieldTime64(OGRFeature *poFeature, int i, int64_t nIdxInBatch,
+                            const arrow::Array *array)
+{
+    const auto castArray = static_cast<const arrow::Time64Array *>(array);
+    poFeature->SetField(i,
+                        static_cast<GIntBig>(castArray->Value(nIdxInBatch)));
+}
+
+template <class ArrayType>
+static void ReadFieldDecimal(OGRFeature *poFeature, int i, int64_t nIdxInBatch,
+                             const arrow::Array *array)
+{
+    const auto castArray = static_cast<const ArrayType *>(array);
+    poFeature->SetField(
+        i, GetDecimalAsDouble(castArray, nIdxInBatch, GetDecimalScale(array)));
+}
+
+static void ReadFieldLargeString(OGRFeature *poFeature, int i,
+                                 int64_t nIdxInBatch, const arrow::Array *array)
+{
+    const auto castArray = static_cast<const arrow::LargeStringArray *>(array);
+    int64_t out_length = 0;
+    const uint8_t *data = castArray->GetValue(nIdxInBatch, &out_length);
+    char *pszString =
+        static_cast<char *>(CPLMalloc(static_cast<size_t>(out_length) + 1));
+    memcpy(pszString, data, static_cast<size_t>(out_length));
+    pszString[out_length] = 0;
+    poFeature->SetFieldSameTypeUnsafe(i, pszString);
+}
+
+static void ReadFieldLargeBinary(OGRFeature *poFeature, int i,
+                                 int64_t nIdxInBatch, const arrow::Array *array)
+{
+    const auto castArray = static_cast<const arrow::LargeBinaryArray *>(array);
+    arrow::LargeBinaryArray::offset_type out_length = 0;
+    const uint8_t *data = castArray->GetValue(nIdxInBatch, &out_length);
+    if (out_length <= INT_MAX)
+    {
+        poFeature->SetField(i, static_cast<int>(out_length), data);
+    }
+    else
+    {
+        // this is probably the most likely code path if people use
+        // LargeBinary...
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Too large binary: " CPL_FRMT_GUIB " bytes",
+                 static_cast<GUIntBig>(out_length));
+    }
+}
+
+static void ReadFieldMap(OGRFeature *poFeature, int i, int64_t nIdxInBatch,
+                         const arrow::Array *array)
+{
+    const auto castArray = static_cast<const arrow::MapArray *>(array);
+    CPLJSonStreamingWriter oWriter(nullptr, nullptr);
+    oWriter.SetPrettyFormatting(false);
+    // Rough guess of the serialized size, to avoid the first rounds of
+    // string reallocation.
+    oWriter.Reserve(
+        16 * static_cast<size_t>(castArray->value_length(nIdxInBatch)) + 2);
+    WriteMapAsJSON(oWriter, array, static_cast<size_t>(nIdxInBatch));
+    poFeature->SetField(i, oWriter.GetString().c_str());
+}
+
+// Resolve the function reading one non-null value of the given type into
+// an OGR field. The type of a column does not change during a scan, so
+// the result can be cached per field and called directly for each
+// feature. Returns nullptr for unhandled types.
+static ArrowFieldReaderType GetArrowFieldReader(const arrow::DataType *type)
+{
+    switch (type->id())
+    {
+        case arrow::Type::NA:
+            return ReadFieldNothing;
+        case arrow::Type::BOOL:
+            return ReadFieldScalar<arrow::BooleanArray, int>;
+        case arrow::Type::UINT8:
+            return ReadFieldScalar<arrow::UInt8Array, int>;
+        case arrow::Type::INT8:
+            return ReadFieldScalar<arrow::Int8Array, int>;
+        case arrow::Type::UINT16:
+            return ReadFieldScalar<arrow::UInt16Array, int>;
+        case arrow::Type::INT16:
+            return ReadFieldScalar<arrow::Int16Array, int>;
+        case arrow::Type::UINT32:
+            return ReadFieldScalar<arrow::UInt32Array, GIntBig>;
+        case arrow::Type::INT32:
+            return ReadFieldScalar<arrow::Int32Array, int>;
+        case arrow::Type::UINT64:
+            return ReadFieldScalar<arrow::UInt64Array, double>;
+        case arrow::Type::INT64:
+            return ReadFieldScalar<arrow::Int64Array, GIntBig>;
+        case arrow::Type::HALF_FLOAT:
+            return ReadFieldHalfFloat;
+        case arrow::Type::FLOAT:
+            return ReadFieldScalar<arrow::FloatArray, double>;
+        case arrow::Type::DOUBLE:
+            return ReadFieldScalar<arrow::DoubleArray, double>;
+        case arrow::Type::STRING:
+            return ReadFieldString;
+        case arrow::Type::BINARY:
+            return ReadFieldBinary;
+        case arrow::Type::FIXED_SIZE_BINARY:
+            return ReadFieldFixedSizeBinary;
+        case arrow::Type::DATE32:
+            return ReadFieldDate32;
+        case arrow::Type::DATE64:
+            return ReadFieldDate64;
+        case arrow::Type::TIMESTAMP:
         {
-            const auto values =
-                std::static_pointer_cast<arrow::Decimal128Array>(
-                    array->values());
-            const auto nIdxStart = array->value_offset(nIdxInArray);
-            const int nCount = array->value_length(nIdxInArray);
-            std::vector<double> aValues;
-            aValues.reserve(nCount);
-            for (int k = 0; k < nCount; k++)
+            switch (static_cast<const arrow::TimestampType *>(type)->unit())
             {
-                if (values->IsNull(nIdxStart + k))
-                    aValues.push_back(std::numeric_limits<double>::quiet_NaN());
-                else
-                    aValues.push_back(
-                        CPLAtof(values->FormatValue(nIdxStart + k).c_str()));
+                case arrow::TimeUnit::SECOND:
+                    return ReadFieldTimestamp<arrow::TimeUnit::SECOND>;
+                case arrow::TimeUnit::MILLI:
+                    return ReadFieldTimestamp<arrow::TimeUnit::MILLI>;
+                case arrow::TimeUnit::MICRO:
+                    return ReadFieldTimestamp<arrow::TimeUnit::MICRO>;
+                case arrow::TimeUnit::NANO:
+                    return ReadFieldTimestamp<arrow::TimeUnit::NANO>;
             }
-            poFeature->SetField(i, nCount, aValues.data());
-            break;
+            return nullptr;
         }
-
+        case arrow::Type::TIME32:
+            return ReadFieldTime32;
+        case arrow::Type::TIME64:
+            return ReadFieldTime64;
+        case arrow::Type::DECIMAL128:
+            return ReadFieldDecimal<arrow::Decimal128Array>;
         case arrow::Type::DECIMAL256:
+            return ReadFieldDecimal<arrow::Decimal256Array>;
+        case arrow::Type::LIST:
         {
-            const auto values =
-                std::static_pointer_cast<arrow::Decimal256Array>(
-                    array->values());
-            const auto nIdxStart = array->value_offset(nIdxInArray);
-            const int nCount = array->value_length(nIdxInArray);
-            std::vector<double> aValues;
-            aValues.reserve(nCount);
-            for (int k = 0; k < nCount; k++)
+            const auto listType = static_cast<const arrow::ListType *>(type);
+            auto pfnReader = GetReadListFunc<arrow::ListArray>(
+                listType->value_field()->type()->id());
+            if (pfnReader == nullptr)
             {
-                if (values->IsNull(nIdxStart + k))
-                    aValues.push_back(std::numeric_limits<double>::quiet_NaN());
-                else
-                    aValues.push_back(
-                        CPLAtof(values->FormatValue(nIdxStart + k).c_str()));
+                CPLDebug("ARROW", "ReadList(): unexpected data type %s",
+                         listType->value_field()->type()->ToString().c_str());
+                pfnReader = ReadFieldNothing;
             }
-            poFeature->SetField(i, nCount, aValues.data());
-            break;
+            return pfnReader;
         }
-
-        case arrow::Type::STRING:
+        case arrow::Type::FIXED_SIZE_LIST:
         {
-            const auto values =
-                std::static_pointer_cast<arrow::StringArray>(array->values());
-            const auto nIdxStart = array->value_offset(nIdxInArray);
-            const int nCount = array->value_length(nIdxInArray);
-            CPLStringList aosList;
-            for (int k = 0; k < nCount; k++)
+            const auto listType =
+                static_cast<const arrow::FixedSizeListType *>(type);
+            auto pfnReader = GetReadListFunc<arrow::FixedSizeListArray>(
+                listType->value_field()->type()->id());
+            if (pfnReader == nullptr)
             {
-                if (values->IsNull(nIdxStart + k))
-                    aosList.AddString(
-                        "");  // we cannot have null strings in a list
-                else
-                    aosList.AddString(values->GetString(nIdxStart + k).c_str());
+                CPLDebug("ARROW", "ReadList(): unexpected data type %s",
+                         listType->value_field()->type()->ToString().c_str());
+                pfnReader = ReadFieldNothing;
             }
-            poFeature->SetField(i, aosList.List());
-            break;
+            return pfnReader;
         }
         case arrow::Type::LARGE_STRING:
-        {
-            const auto values =
-                std::static_pointer_cast<arrow::LargeStringArray>(
-                    array->values());
-            const auto nIdxStart = array->value_offset(nIdxInArray);
-            const auto nCount = array->value_length(nIdxInArray);
-            CPLStringList aosList;
-            for (auto k = decltype(nCount){0}; k < nCount; k++)
-            {
-                if (values->IsNull(nIdxStart + k))
-                    aosList.AddString(
-                        "");  // we cannot have null strings in a list
-                else
-                    aosList.AddString(values->GetString(nIdxStart + k).c_str());
-            }
-            poFeature->SetField(i, aosList.List());
-            break;
-        }
-        case arrow::Type::LIST:
-        case arrow::Type::LARGE_LIST:
-        case arrow::Type::FIXED_SIZE_LIST:
+            return ReadFieldLargeString;
+        case arrow::Type::LARGE_BINARY:
+            return ReadFieldLargeBinary;
         case arrow::Type::MAP:
-        case arrow::Type::STRUCT:
-        {
-            poFeature->SetField(i,
-                                GetListAsJSON(array, nIdxInArray)
-                                    .Format(CPLJSONObject::PrettyFormat::Plain)
-                                    .c_str());
-            break;
-        }
-
+            return ReadFieldMap;
         default:
-        {
-            CPLDebug("ARROW", "ReadList(): unexpected data type %s",
-                     array->values()->type()->ToString().c_str());
-            break;
-        }
+            return nullptr;
     }
 }
 
@@ -1580,8 +2510,7 @@ static void ReadList(OGRFeature *poFeature, int i, int64_t nIdxInArray,
 /************************************************************************/
 
 template <bool bHasZ, bool bHasM, int nDim>
-void SetPointsOfLine(OGRLineString *poLS,
-                     const std::shared_ptr<arrow::DoubleArray> &pointValues,
+void SetPointsOfLine(OGRLineString *poLS, const arrow::DoubleArray *pointValues,
                      int pointOffset, int numPoints)
 {
     if (!bHasZ && !bHasM)
@@ -1594,47 +2523,141 @@ void SetPointsOfLine(OGRLineString *poLS,
         return;
     }
 
-    poLS->setNumPoints(numPoints, FALSE);
-    for (int k = 0; k < numPoints; k++)
+    // Deinterleave the coordinates into contiguous per-component arrays
+    // and use a single bulk setPoints() call, rather than issuing one
+    // setPoint() call, with its bounds check and lazy Z/M allocation, per
+    // vertex. The compile-time constant stride lets the compiler vectorize
+    // the deinterleaving loop.
+    const double *padfValues = pointValues->raw_values() + pointOffset;
+    std::vector<double> adfX(numPoints);
+    std::vector<double> adfY(numPoints);
+    std::vector<double> adfZ(bHasZ ? numPoints : 0);
+    std::vector<double> adfM(bHasM ? numPoints : 0);
+    for (int k = 0; k < numPoints; k++)
+    {
+        adfX[k] = padfValues[nDim * k];
+        adfY[k] = padfValues[nDim * k + 1];
+        if (bHasZ)
+            adfZ[k] = padfValues[nDim * k + 2];
+        if (bHasM)
+            adfM[k] = padfValues[nDim * k + (bHasZ ? 3 : 2)];
+    }
+    if (bHasZ && bHasM)
+    {
+        poLS->setPoints(numPoints, adfX.data(), adfY.data(), adfZ.data(),
+                        adfM.data());
+    }
+    else if (bHasM)
+    {
+        poLS->setPointsM(numPoints, adfX.data(), adfY.data(), adfM.data());
+    }
+    else
+    {
+        poLS->setPoints(numPoints, adfX.data(), adfY.data(), adfZ.data());
+    }
+}
+
+typedef void (*SetPointsOfLineType)(OGRLineString *,
+                                    const arrow::DoubleArray *, int, int);
+
+static SetPointsOfLineType GetSetPointsOfLine(bool bHasZ, bool bHasM)
+{
+    if (bHasZ && bHasM)
+        return SetPointsOfLine<true, true, 4>;
+    if (bHasZ)
+        return SetPointsOfLine<true, false, 3>;
+    if (bHasM)
+        return SetPointsOfLine<false, true, 3>;
+    return SetPointsOfLine<false, false, 2>;
+}
+
+/************************************************************************/
+/*                      AddPointsToMultiPoint()                         */
+/************************************************************************/
+
+// Append nPoints points read from an interleaved coordinate buffer,
+// with the dimensionality resolved at compile time so that the
+// per-vertex work reduces to the OGRPoint construction itself.
+template <bool bHasZ, bool bHasM, int nDim>
+void AddPointsToMultiPoint(OGRMultiPoint *poMultiPoint,
+                           const double *padfValues, const int nPoints)
+{
+    for (int k = 0; k < nPoints; ++k, padfValues += nDim)
     {
+        OGRPoint *poPoint;
         if (bHasZ)
         {
             if (bHasM)
             {
-                poLS->setPoint(k, pointValues->Value(pointOffset + nDim * k),
-                               pointValues->Value(pointOffset + nDim * k + 1),
-                               pointValues->Value(pointOffset + nDim * k + 2),
-                               pointValues->Value(pointOffset + nDim * k + 3));
+                poPoint = new OGRPoint(padfValues[0], padfValues[1],
+                                       padfValues[2], padfValues[3]);
             }
             else
             {
-                poLS->setPoint(k, pointValues->Value(pointOffset + nDim * k),
-                               pointValues->Value(pointOffset + nDim * k + 1),
-                               pointValues->Value(pointOffset + nDim * k + 2));
+                poPoint = new OGRPoint(padfValues[0], padfValues[1],
+                                       padfValues[2]);
             }
         }
-        else /* if( bHasM ) */
+        else if (bHasM)
+        {
+            poPoint = OGRPoint::createXYM(padfValues[0], padfValues[1],
+                                          padfValues[2]);
+        }
+        else
         {
-            poLS->setPointM(k, pointValues->Value(pointOffset + nDim * k),
-                            pointValues->Value(pointOffset + nDim * k + 1),
-                            pointValues->Value(pointOffset + nDim * k + 2));
+            poPoint = new OGRPoint(padfValues[0], padfValues[1]);
         }
+        poMultiPoint->addGeometryDirectly(poPoint);
     }
 }
 
-typedef void (*SetPointsOfLineType)(OGRLineString *,
-                                    const std::shared_ptr<arrow::DoubleArray> &,
-                                    int, int);
+typedef void (*AddPointsToMultiPointType)(OGRMultiPoint *, const double *,
+                                          const int);
 
-static SetPointsOfLineType GetSetPointsOfLine(bool bHasZ, bool bHasM)
+static AddPointsToMultiPointType GetAddPointsToMultiPoint(bool bHasZ,
+                                                          bool bHasM)
 {
     if (bHasZ && bHasM)
-        return SetPointsOfLine<true, true, 4>;
+        return AddPointsToMultiPoint<true, true, 4>;
     if (bHasZ)
-        return SetPointsOfLine<true, false, 3>;
+        return AddPointsToMultiPoint<true, false, 3>;
     if (bHasM)
-        return SetPointsOfLine<false, true, 3>;
-    return SetPointsOfLine<false, false, 2>;
+        return AddPointsToMultiPoint<false, true, 3>;
+    return AddPointsToMultiPoint<false, false, 2>;
+}
+
+/************************************************************************/
+/*                        MergePointsEnvelope()                         */
+/************************************************************************/
+
+/** Merge nPoints interleaved coordinates into sEnvelope.
+ *
+ * Accumulating into plain locals rather than calling
+ * OGREnvelope::Merge() per point lets the compiler keep the running
+ * min/max in registers and emit branchless (or vector) min/max
+ * instructions. The ternaries replicate the exact NaN behaviour of the
+ * MIN/MAX macros used by OGREnvelope::Merge().
+ */
+static void MergePointsEnvelope(const double *padfValues, int nDim,
+                                int32_t nPoints, OGREnvelope &sEnvelope)
+{
+    double dfMinX = sEnvelope.MinX;
+    double dfMinY = sEnvelope.MinY;
+    double dfMaxX = sEnvelope.MaxX;
+    double dfMaxY = sEnvelope.MaxY;
+    for (int32_t l = 0; l < nPoints; ++l)
+    {
+        const double dfX = padfValues[nDim * l];
+        const double dfY = padfValues[nDim * l + 1];
+        dfMinX = (dfMinX < dfX) ? dfMinX : dfX;
+        dfMinY = (dfMinY < dfY) ? dfMinY : dfY;
+        dfMaxX = (dfMaxX > dfX) ? dfMaxX : dfX;
+        dfMaxY = (dfMaxY > dfY) ? dfMaxY : dfY;
+    }
+    sEnvelope.MinX = dfMinX;
+    sEnvelope.MinY = dfMinY;
+    sEnvelope.MaxX = dfMaxX;
+    sEnvelope.MaxY = dfMaxY;
 }
 
 /************************************************************************/
@@ -1663,20 +2686,7 @@ OGRArrowLayer::TimestampToOGR(int64_t timestamp,
         floatingPart = (timestamp % (1000 * 1000 * 1000)) / 1e9;
         timestamp /= 1000 * 1000 * 1000;
     }
-    if (nTZFlag > OGR_TZFLAG_MIXED_TZ)
-    {
-        const int TZOffset = (nTZFlag - OGR_TZFLAG_UTC) * 15;
-        timestamp += TZOffset * 60;
-    }
-    struct tm dt;
-    CPLUnixTimeToYMDHMS(timestamp, &dt);
-    psField->Date.Year = static_cast<GInt16>(dt.tm_year + 1900);
-    psField->Date.Month = static_cast<GByte>(dt.tm_mon + 1);
-    psField->Date.Day = static_cast<GByte>(dt.tm_mday);
-    psField->Date.Hour = static_cast<GByte>(dt.tm_hour);
-    psField->Date.Minute = static_cast<GByte>(dt.tm_min);
-    psField->Date.TZFlag = static_cast<GByte>(nTZFlag);
-    psField->Date.Second = static_cast<float>(dt.tm_sec + floatingPart);
+    FillDateTimeField(timestamp, floatingPart, nTZFlag, psField);
 }
 
 /************************************************************************/
@@ -1713,8 +2723,11 @@ inline OGRFeature *OGRArrowLayer::ReadFeature(
     }
 
     const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+    if (m_apfnFieldReaders.empty())
+        m_apfnFieldReaders.resize(nFieldCount, nullptr);
     for (int i = 0; i < nFieldCount; ++i)
     {
+        const auto &anPath = m_anMapFieldIndexToArrowColumn[i];
         int iCol;
         if (m_bIgnoredFields)
         {
@@ -1724,30 +2737,32 @@ inline OGRFeature *OGRArrowLayer::ReadFeature(
         }
         else
         {
-            iCol = m_anMapFieldIndexToArrowColumn[i][0];
+            iCol = anPath[0];
         }
 
         const arrow::Array *array = poColumnArrays[iCol].get();
-        if (array->IsNull(nIdxInBatch))
+        // null_count() is cached by Arrow after its first computation:
+        // testing it first skips the bitmap access entirely on the very
+        // common null-free columns.
+        if (array->null_count() != 0 && array->IsNull(nIdxInBatch))
         {
             poFeature->SetFieldNull(i);
             continue;
         }
 
-        int j = 1;
+        size_t j = 1;
         bool bSkipToNextField = false;
         while (array->type_id() == arrow::Type::STRUCT)
         {
             const auto castArray =
                 static_cast<const arrow::StructArray *>(array);
             const auto &subArrays = castArray->fields();
-            CPLAssert(
-                j < static_cast<int>(m_anMapFieldIndexToArrowColumn[i].size()));
-            const int iArrowSubcol = m_anMapFieldIndexToArrowColumn[i][j];
+            CPLAssert(j < anPath.size());
+            const int iArrowSubcol = anPath[j];
             j++;
             CPLAssert(iArrowSubcol < static_cast<int>(subArrays.size()));
             array = subArrays[iArrowSubcol].get();
-            if (array->IsNull(nIdxInBatch))
+            if (array->null_count() != 0 && array->IsNull(nIdxInBatch))
             {
                 poFeature->SetFieldNull(i);
                 bSkipToNextField = true;
@@ -1761,332 +2776,37 @@ inline OGRFeature *OGRArrowLayer::ReadFeature(
         {
             const auto castArray =
                 static_cast<const arrow::DictionaryArray *>(array);
-            m_poReadFeatureTmpArray =
-                castArray->indices();  // does not return a const reference
-            array = m_poReadFeatureTmpArray.get();
-            if (array->IsNull(nIdxInBatch))
+            // indices() may return its shared_ptr by value, but the
+            // pointed-to array is also owned by the dictionary array
+            // itself (a member set at construction), so the raw pointer
+            // stays valid as long as castArray is: no need to hold a
+            // reference, which would cost an atomic refcount per row.
+            array = castArray->indices().get();
+            if (array->null_count() != 0 && array->IsNull(nIdxInBatch))
             {
                 poFeature->SetFieldNull(i);
                 continue;
             }
         }
 
-        switch (array->type_id())
+        // Resolve the reader for this field's type once, then reuse it
+        // for all values of all batches: the column types do not change
+        // during a scan.
+        auto &pfnReader = m_apfnFieldReaders[i];
+        if (pfnReader == nullptr)
         {
-            case arrow::Type::NA:
-                break;
-
-            case arrow::Type::BOOL:
-            {
-                const auto castArray =
-                    static_cast<const arrow::BooleanArray *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, castArray->Value(nIdxInBatch));
-                break;
-            }
-            case arrow::Type::UINT8:
-            {
-                const auto castArray =
-                    static_cast<const arrow::UInt8Array *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, castArray->Value(nIdxInBatch));
-                break;
-            }
-            case arrow::Type::INT8:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Int8Array *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, castArray->Value(nIdxInBatch));
-                break;
-            }
-            case arrow::Type::UINT16:
-            {
-                const auto castArray =
-                    static_cast<const arrow::UInt16Array *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, castArray->Value(nIdxInBatch));
-                break;
-            }
-            case arrow::Type::INT16:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Int16Array *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, castArray->Value(nIdxInBatch));
-                break;
-            }
-            case arrow::Type::UINT32:
-            {
-                const auto castArray =
-                    static_cast<const arrow::UInt32Array *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, static_cast<GIntBig>(castArray->Value(nIdxInBatch)));
-                break;
-            }
-            case arrow::Type::INT32:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Int32Array *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, castArray->Value(nIdxInBatch));
-                break;
-            }
-            case arrow::Type::UINT64:
-            {
-                const auto castArray =
-                    static_cast<const arrow::UInt64Array *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, static_cast<double>(castArray->Value(nIdxInBatch)));
-                break;
-            }
-            case arrow::Type::INT64:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Int64Array *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, static_cast<GIntBig>(castArray->Value(nIdxInBatch)));
-                break;
-            }
-            case arrow::Type::HALF_FLOAT:
-            {
-                const auto castArray =
-                    static_cast<const arrow::HalfFloatArray *>(array);
-                const uint16_t nFloat16 = castArray->Value(nIdxInBatch);
-                uint32_t nFloat32 = CPLHalfToFloat(nFloat16);
-                float f;
-                memcpy(&f, &nFloat32, sizeof(nFloat32));
-                poFeature->SetFieldSameTypeUnsafe(i, f);
-                break;
-            }
-            case arrow::Type::FLOAT:
-            {
-                const auto castArray =
-                    static_cast<const arrow::FloatArray *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, castArray->Value(nIdxInBatch));
-                break;
-            }
-            case arrow::Type::DOUBLE:
-            {
-                const auto castArray =
-                    static_cast<const arrow::DoubleArray *>(array);
-                poFeature->SetFieldSameTypeUnsafe(
-                    i, castArray->Value(nIdxInBatch));
-                break;
-            }
-            case arrow::Type::STRING:
-            {
-                const auto castArray =
-                    static_cast<const arrow::StringArray *>(array);
-                int out_length = 0;
-                const uint8_t *data =
-                    castArray->GetValue(nIdxInBatch, &out_length);
-                char *pszString =
-                    static_cast<char *>(CPLMalloc(out_length + 1));
-                memcpy(pszString, data, out_length);
-                pszString[out_length] = 0;
-                poFeature->SetFieldSameTypeUnsafe(i, pszString);
-                break;
-            }
-            case arrow::Type::BINARY:
-            {
-                const auto castArray =
-                    static_cast<const arrow::BinaryArray *>(array);
-                int out_length = 0;
-                const uint8_t *data =
-                    castArray->GetValue(nIdxInBatch, &out_length);
-                poFeature->SetField(i, out_length, data);
-                break;
-            }
-            case arrow::Type::FIXED_SIZE_BINARY:
-            {
-                const auto castArray =
-                    static_cast<const arrow::FixedSizeBinaryArray *>(array);
-                const uint8_t *data = castArray->GetValue(nIdxInBatch);
-                poFeature->SetField(i, castArray->byte_width(), data);
-                break;
-            }
-            case arrow::Type::DATE32:
-            {
-                // number of days since Epoch
-                const auto castArray =
-                    static_cast<const arrow::Date32Array *>(array);
-                int64_t timestamp =
-                    static_cast<int64_t>(castArray->Value(nIdxInBatch)) * 3600 *
-                    24;
-                struct tm dt;
-                CPLUnixTimeToYMDHMS(timestamp, &dt);
-                poFeature->SetField(i, dt.tm_year + 1900, dt.tm_mon + 1,
-                                    dt.tm_mday, 0, 0, 0);
-                break;
-            }
-            case arrow::Type::DATE64:
-            {
-                // number of milliseconds since Epoch
-                const auto castArray =
-                    static_cast<const arrow::Date64Array *>(array);
-                int64_t timestamp =
-                    static_cast<int64_t>(castArray->Value(nIdxInBatch)) / 1000;
-                struct tm dt;
-                CPLUnixTimeToYMDHMS(timestamp, &dt);
-                poFeature->SetField(i, dt.tm_year + 1900, dt.tm_mon + 1,
-                                    dt.tm_mday, 0, 0, 0);
-                break;
-            }
-            case arrow::Type::TIMESTAMP:
-            {
-                const auto timestampType = static_cast<arrow::TimestampType *>(
-                    array->data()->type.get());
-                const auto castArray =
-                    static_cast<const arrow::Int64Array *>(array);
-                const int64_t timestamp = castArray->Value(nIdxInBatch);
-                OGRField sField;
-                sField.Set.nMarker1 = OGRUnsetMarker;
-                sField.Set.nMarker2 = OGRUnsetMarker;
-                sField.Set.nMarker3 = OGRUnsetMarker;
-                TimestampToOGR(timestamp, timestampType,
-                               m_poFeatureDefn->GetFieldDefn(i)->GetTZFlag(),
-                               &sField);
-                poFeature->SetField(i, &sField);
-                break;
-            }
-            case arrow::Type::TIME32:
-            {
-                const auto timestampType =
-                    static_cast<arrow::Time32Type *>(array->data()->type.get());
-                const auto castArray =
-                    static_cast<const arrow::Int32Array *>(array);
-                const auto unit = timestampType->unit();
-                int value = castArray->Value(nIdxInBatch);
-                double floatingPart = 0;
-                if (unit == arrow::TimeUnit::MILLI)
-                {
-                    floatingPart = (value % 1000) / 1e3;
-                    value /= 1000;
-                }
-                const int nHour = value / 3600;
-                const int nMinute = (value / 60) % 60;
-                const int nSecond = value % 60;
-                poFeature->SetField(i, 0, 0, 0, nHour, nMinute,
-                                    static_cast<float>(nSecond + floatingPart));
-                break;
-            }
-            case arrow::Type::TIME64:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Time64Array *>(array);
-                poFeature->SetField(
-                    i, static_cast<GIntBig>(castArray->Value(nIdxInBatch)));
-                break;
-            }
-
-            case arrow::Type::DECIMAL128:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Decimal128Array *>(array);
-                poFeature->SetField(
-                    i, CPLAtof(castArray->FormatValue(nIdxInBatch).c_str()));
-                break;
-            }
-
-            case arrow::Type::DECIMAL256:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Decimal256Array *>(array);
-                poFeature->SetField(
-                    i, CPLAtof(castArray->FormatValue(nIdxInBatch).c_str()));
-                break;
-            }
-
-            case arrow::Type::LIST:
-            {
-                const auto castArray =
-                    static_cast<const arrow::ListArray *>(array);
-                const auto listType = static_cast<const arrow::ListType *>(
-                    array->data()->type.get());
-                ReadList(poFeature, i, nIdxInBatch, castArray,
-                         listType->value_field()->type()->id());
-                break;
-            }
-
-            case arrow::Type::FIXED_SIZE_LIST:
-            {
-                const auto castArray =
-                    static_cast<const arrow::FixedSizeListArray *>(array);
-                const auto listType =
-                    static_cast<const arrow::FixedSizeListType *>(
-                        array->data()->type.get());
-                ReadList(poFeature, i, nIdxInBatch, castArray,
-                         listType->value_field()->type()->id());
-                break;
-            }
-
-            case arrow::Type::LARGE_STRING:
-            {
-                const auto castArray =
-                    static_cast<const arrow::LargeStringArray *>(array);
-                poFeature->SetField(i,
-                                    castArray->GetString(nIdxInBatch).c_str());
-                break;
-            }
-            case arrow::Type::LARGE_BINARY:
-            {
-                const auto castArray =
-                    static_cast<const arrow::LargeBinaryArray *>(array);
-                arrow::LargeBinaryArray::offset_type out_length = 0;
-                const uint8_t *data =
-                    castArray->GetValue(nIdxInBatch, &out_length);
-                if (out_length <= INT_MAX)
-                {
-                    poFeature->SetField(i, static_cast<int>(out_length), data);
-                }
-                else
-                {
-                    // this is probably the most likely code path if people use
-                    // LargeBinary...
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Too large binary: " CPL_FRMT_GUIB " bytes",
-                             static_cast<GUIntBig>(out_length));
-                }
-                break;
-            }
-
-            case arrow::Type::MAP:
-            {
-                const auto castArray =
-                    static_cast<const arrow::MapArray *>(array);
-                poFeature->SetField(
-                    i, GetMapAsJSON(castArray, nIdxInBatch)
-                           .Format(CPLJSONObject::PrettyFormat::Plain)
-                           .c_str());
-                break;
-            }
-
-            // unhandled types
-            case arrow::Type::STRUCT:  // should not happen
-            case arrow::Type::INTERVAL_MONTHS:
-            case arrow::Type::INTERVAL_DAY_TIME:
-            case arrow::Type::SPARSE_UNION:
-            case arrow::Type::DENSE_UNION:
-            case arrow::Type::DICTIONARY:
-            case arrow::Type::EXTENSION:
-            case arrow::Type::DURATION:
-            case arrow::Type::LARGE_LIST:
-            case arrow::Type::INTERVAL_MONTH_DAY_NANO:
-#if ARROW_VERSION_MAJOR >= 12
-            case arrow::Type::RUN_END_ENCODED:
-#endif
-            case arrow::Type::MAX_ID:
+            pfnReader = GetArrowFieldReader(array->data()->type.get());
+            if (pfnReader == nullptr)
             {
                 // Shouldn't happen normally as we should have discarded those
                 // fields when creating OGR field definitions
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Cannot read content for field %s",
                          m_poFeatureDefn->GetFieldDefn(i)->GetNameRef());
-                break;
+                pfnReader = ReadFieldNothing;
             }
         }
+        pfnReader(poFeature, i, nIdxInBatch, array);
     }
 
     const int nGeomFieldCount = m_poFeatureDefn->GetGeomFieldCount();
@@ -2151,36 +2871,32 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
     const bool bHasM = CPL_TO_BOOL(OGR_GT_HasM(eGeomType));
     const int nDim = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
 
-    const auto CreatePoint =
-        [bHasZ, bHasM](const std::shared_ptr<arrow::DoubleArray> &pointValues,
-                       int pointOffset)
+    // The caller hoists pointValues->raw_values() (already adjusted for the
+    // array offset) out of its loop, so that each ordinate is a plain array
+    // load instead of a Value() call redoing the offset arithmetic.
+    const auto CreatePoint = [bHasZ, bHasM](const double *padfValues)
     {
         if (bHasZ)
         {
             if (bHasM)
             {
-                return new OGRPoint(pointValues->Value(pointOffset),
-                                    pointValues->Value(pointOffset + 1),
-                                    pointValues->Value(pointOffset + 2),
-                                    pointValues->Value(pointOffset + 3));
+                return new OGRPoint(padfValues[0], padfValues[1], padfValues[2],
+                                    padfValues[3]);
             }
             else
             {
-                return new OGRPoint(pointValues->Value(pointOffset),
-                                    pointValues->Value(pointOffset + 1),
-                                    pointValues->Value(pointOffset + 2));
+                return new OGRPoint(padfValues[0], padfValues[1],
+                                    padfValues[2]);
             }
         }
         else if (bHasM)
         {
-            return OGRPoint::createXYM(pointValues->Value(pointOffset),
-                                       pointValues->Value(pointOffset + 1),
-                                       pointValues->Value(pointOffset + 2));
+            return OGRPoint::createXYM(padfValues[0], padfValues[1],
+                                       padfValues[2]);
         }
         else
         {
-            return new OGRPoint(pointValues->Value(pointOffset),
-                                pointValues->Value(pointOffset + 1));
+            return new OGRPoint(padfValues[0], padfValues[1]);
         }
     };
 
@@ -2210,9 +2926,15 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
                 }
                 out_length = static_cast<int>(out_length64);
             }
-            if (OGRGeometryFactory::createFromWkb(
-                    data, poGeomFieldDefn->GetSpatialRef(), &poGeometry,
-                    out_length) == OGRERR_NONE)
+            poGeometry = OGRWKBCreateGeometryFast(data, out_length);
+            if (poGeometry)
+            {
+                poGeometry->assignSpatialReference(
+                    poGeomFieldDefn->GetSpatialRef());
+            }
+            else if (OGRGeometryFactory::createFromWkb(
+                         data, poGeomFieldDefn->GetSpatialRef(), &poGeometry,
+                         out_length) == OGRERR_NONE)
             {
 #ifdef DEBUG_ReadWKBBoundingBox
                 OGREnvelope sEnvelopeFromWKB;
@@ -2229,25 +2951,27 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
 
         case OGRArrowGeomEncoding::WKT:
         {
+            // createFromWkt() needs a NUL-terminated string: copy the
+            // cell into a scratch member whose capacity is reused
+            // across rows, rather than into a fresh std::string.
             if (array->type_id() == arrow::Type::STRING)
             {
                 const auto castArray =
                     static_cast<const arrow::StringArray *>(array);
-                const auto osWKT = castArray->GetString(nIdxInBatch);
-                OGRGeometryFactory::createFromWkt(
-                    osWKT.c_str(), poGeomFieldDefn->GetSpatialRef(),
-                    &poGeometry);
+                const auto sv = castArray->GetView(nIdxInBatch);
+                m_osWKTScratch.assign(sv.data(), sv.size());
             }
             else
             {
                 CPLAssert(array->type_id() == arrow::Type::LARGE_STRING);
                 const auto castArray =
                     static_cast<const arrow::LargeStringArray *>(array);
-                const auto osWKT = castArray->GetString(nIdxInBatch);
-                OGRGeometryFactory::createFromWkt(
-                    osWKT.c_str(), poGeomFieldDefn->GetSpatialRef(),
-                    &poGeometry);
+                const auto sv = castArray->GetView(nIdxInBatch);
+                m_osWKTScratch.assign(sv.data(), sv.size());
             }
+            OGRGeometryFactory::createFromWkt(m_osWKTScratch.c_str(),
+                                              poGeomFieldDefn->GetSpatialRef(),
+                                              &poGeometry);
             break;
         }
 
@@ -2263,13 +2987,15 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
             const auto listArray =
                 static_cast<const arrow::FixedSizeListArray *>(array);
             CPLAssert(listArray->values()->type_id() == arrow::Type::DOUBLE);
-            const auto pointValues =
-                std::static_pointer_cast<arrow::DoubleArray>(
-                    listArray->values());
+            // Casting on the raw pointer rather than keeping the
+            // shared_ptr alive is fine: the child array is owned by a
+            // member of its parent, which outlives this function.
+            const auto pointValues = static_cast<const arrow::DoubleArray *>(
+                listArray->values().get());
             if (!pointValues->IsNull(nDim * nIdxInBatch))
             {
-                poGeometry = CreatePoint(pointValues,
-                                         static_cast<int>(nDim * nIdxInBatch));
+                poGeometry = CreatePoint(pointValues->raw_values() +
+                                         nDim * nIdxInBatch);
                 poGeometry->assignSpatialReference(
                     poGeomFieldDefn->GetSpatialRef());
             }
@@ -2283,13 +3009,12 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
             CPLAssert(listArray->values()->type_id() ==
                       arrow::Type::FIXED_SIZE_LIST);
             const auto listOfPointsValues =
-                std::static_pointer_cast<arrow::FixedSizeListArray>(
-                    listArray->values());
+                static_cast<const arrow::FixedSizeListArray *>(
+                    listArray->values().get());
             CPLAssert(listOfPointsValues->values()->type_id() ==
                       arrow::Type::DOUBLE);
-            const auto pointValues =
-                std::static_pointer_cast<arrow::DoubleArray>(
-                    listOfPointsValues->values());
+            const auto pointValues = static_cast<const arrow::DoubleArray *>(
+                listOfPointsValues->values().get());
             const auto nPoints = listArray->value_length(nIdxInBatch);
             const auto nPointOffset =
                 listArray->value_offset(nIdxInBatch) * nDim;
@@ -2318,32 +3043,34 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
             CPLAssert(listOfRingsArray->values()->type_id() ==
                       arrow::Type::LIST);
             const auto listOfRingsValues =
-                std::static_pointer_cast<arrow::ListArray>(
-                    listOfRingsArray->values());
+                static_cast<const arrow::ListArray *>(
+                    listOfRingsArray->values().get());
             CPLAssert(listOfRingsValues->values()->type_id() ==
                       arrow::Type::FIXED_SIZE_LIST);
             const auto listOfPointsValues =
-                std::static_pointer_cast<arrow::FixedSizeListArray>(
-                    listOfRingsValues->values());
+                static_cast<const arrow::FixedSizeListArray *>(
+                    listOfRingsValues->values().get());
             CPLAssert(listOfPointsValues->values()->type_id() ==
                       arrow::Type::DOUBLE);
-            const auto pointValues =
-                std::static_pointer_cast<arrow::DoubleArray>(
-                    listOfPointsValues->values());
+            const auto pointValues = static_cast<const arrow::DoubleArray *>(
+                listOfPointsValues->values().get());
             const auto setPointsFun = GetSetPointsOfLine(bHasZ, bHasM);
             const auto nRings = listOfRingsArray->value_length(nIdxInBatch);
             const auto nRingOffset =
                 listOfRingsArray->value_offset(nIdxInBatch);
+            // Index the offsets buffer directly rather than going
+            // through value_offset()/value_length() at each iteration
+            const auto panRingOffsets =
+                listOfRingsValues->raw_value_offsets() + nRingOffset;
             auto poPoly = new OGRPolygon();
+            poPoly->reserveRings(static_cast<int>(nRings));
             poGeometry = poPoly;
             poGeometry->assignSpatialReference(
                 poGeomFieldDefn->GetSpatialRef());
             for (auto k = decltype(nRings){0}; k < nRings; k++)
             {
-                const auto nPoints =
-                    listOfRingsValues->value_length(nRingOffset + k);
-                const auto nPointOffset =
-                    listOfRingsValues->value_offset(nRingOffset + k) * nDim;
+                const auto nPoints = panRingOffsets[k + 1] - panRingOffsets[k];
+                const auto nPointOffset = panRingOffsets[k] * nDim;
                 auto poRing = new OGRLinearRing();
                 if (nPoints)
                 {
@@ -2366,25 +3093,23 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
             CPLAssert(listArray->values()->type_id() ==
                       arrow::Type::FIXED_SIZE_LIST);
             const auto listOfPointsValues =
-                std::static_pointer_cast<arrow::FixedSizeListArray>(
-                    listArray->values());
+                static_cast<const arrow::FixedSizeListArray *>(
+                    listArray->values().get());
             CPLAssert(listOfPointsValues->values()->type_id() ==
                       arrow::Type::DOUBLE);
-            const auto pointValues =
-                std::static_pointer_cast<arrow::DoubleArray>(
-                    listOfPointsValues->values());
+            const auto pointValues = static_cast<const arrow::DoubleArray *>(
+                listOfPointsValues->values().get());
             const auto nPoints = listArray->value_length(nIdxInBatch);
-            const auto nPointOffset =
+            const double *padfValues =
+                pointValues->raw_values() +
                 listArray->value_offset(nIdxInBatch) * nDim;
             auto poMultiPoint = new OGRMultiPoint();
+            poMultiPoint->reserve(static_cast<int>(nPoints));
             poGeometry = poMultiPoint;
             poGeometry->assignSpatialReference(
                 poGeomFieldDefn->GetSpatialRef());
-            for (auto k = decltype(nPoints){0}; k < nPoints; k++)
-            {
-                poMultiPoint->addGeometryDirectly(
-                    CreatePoint(pointValues, nPointOffset + k * nDim));
-            }
+            GetAddPointsToMultiPoint(bHasZ, bHasM)(poMultiPoint, padfValues,
+                                                   nPoints);
             if (poGeometry->IsEmpty())
             {
                 poGeometry->set3D(bHasZ);
@@ -2401,32 +3126,33 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
             CPLAssert(listOfStringsArray->values()->type_id() ==
                       arrow::Type::LIST);
             const auto listOfStringsValues =
-                std::static_pointer_cast<arrow::ListArray>(
-                    listOfStringsArray->values());
+                static_cast<const arrow::ListArray *>(
+                    listOfStringsArray->values().get());
             CPLAssert(listOfStringsValues->values()->type_id() ==
                       arrow::Type::FIXED_SIZE_LIST);
             const auto listOfPointsValues =
-                std::static_pointer_cast<arrow::FixedSizeListArray>(
-                    listOfStringsValues->values());
+                static_cast<const arrow::FixedSizeListArray *>(
+                    listOfStringsValues->values().get());
             CPLAssert(listOfPointsValues->values()->type_id() ==
                       arrow::Type::DOUBLE);
-            const auto pointValues =
-                std::static_pointer_cast<arrow::DoubleArray>(
-                    listOfPointsValues->values());
+            const auto pointValues = static_cast<const arrow::DoubleArray *>(
+                listOfPointsValues->values().get());
             const auto setPointsFun = GetSetPointsOfLine(bHasZ, bHasM);
             const auto nStrings = listOfStringsArray->value_length(nIdxInBatch);
             const auto nRingOffset =
                 listOfStringsArray->value_offset(nIdxInBatch);
+            const auto panStringOffsets =
+                listOfStringsValues->raw_value_offsets() + nRingOffset;
             auto poMLS = new OGRMultiLineString();
+            poMLS->reserve(static_cast<int>(nStrings));
             poGeometry = poMLS;
             poGeometry->assignSpatialReference(
                 poGeomFieldDefn->GetSpatialRef());
             for (auto k = decltype(nStrings){0}; k < nStrings; k++)
             {
                 const auto nPoints =
-                    listOfStringsValues->value_length(nRingOffset + k);
-                const auto nPointOffset =
-                    listOfStringsValues->value_offset(nRingOffset + k) * nDim;
+                    panStringOffsets[k + 1] - panStringOffsets[k];
+                const auto nPointOffset = panStringOffsets[k] * nDim;
                 auto poLS = new OGRLineString();
                 if (nPoints)
                 {
@@ -2450,23 +3176,22 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
             CPLAssert(listOfPartsArray->values()->type_id() ==
                       arrow::Type::LIST);
             const auto listOfPartsValues =
-                std::static_pointer_cast<arrow::ListArray>(
-                    listOfPartsArray->values());
+                static_cast<const arrow::ListArray *>(
+                    listOfPartsArray->values().get());
             CPLAssert(listOfPartsValues->values()->type_id() ==
                       arrow::Type::LIST);
             const auto listOfRingsValues =
-                std::static_pointer_cast<arrow::ListArray>(
-                    listOfPartsValues->values());
+                static_cast<const arrow::ListArray *>(
+                    listOfPartsValues->values().get());
             CPLAssert(listOfRingsValues->values()->type_id() ==
                       arrow::Type::FIXED_SIZE_LIST);
             const auto listOfPointsValues =
-                std::static_pointer_cast<arrow::FixedSizeListArray>(
-                    listOfRingsValues->values());
+                static_cast<const arrow::FixedSizeListArray *>(
+                    listOfRingsValues->values().get());
             CPLAssert(listOfPointsValues->values()->type_id() ==
                       arrow::Type::DOUBLE);
-            const auto pointValues =
-                std::static_pointer_cast<arrow::DoubleArray>(
-                    listOfPointsValues->values());
+            const auto pointValues = static_cast<const arrow::DoubleArray *>(
+                listOfPointsValues->values().get());
             auto poMP = new OGRMultiPolygon();
             poGeometry = poMP;
             poGeometry->assignSpatialReference(
@@ -2475,19 +3200,23 @@ inline OGRGeometry *OGRArrowLayer::ReadGeometry(int iGeomField,
             const auto nParts = listOfPartsArray->value_length(nIdxInBatch);
             const auto nPartOffset =
                 listOfPartsArray->value_offset(nIdxInBatch);
+            const auto panPartOffsets =
+                listOfPartsValues->raw_value_offsets() + nPartOffset;
+            const auto panRingOffsets =
+                listOfRingsValues->raw_value_offsets();
+            poMP->reserve(static_cast<int>(nParts));
             for (auto j = decltype(nParts){0}; j < nParts; j++)
             {
-                const auto nRings =
-                    listOfPartsValues->value_length(nPartOffset + j);
-                const auto nRingOffset =
-                    listOfPartsValues->value_offset(nPartOffset + j);
+                const auto nRings = panPartOffsets[j + 1] - panPartOffsets[j];
+                const auto nRingOffset = panPartOffsets[j];
                 auto poPoly = new OGRPolygon();
+                poPoly->reserveRings(static_cast<int>(nRings));
                 for (auto k = decltype(nRings){0}; k < nRings; k++)
                 {
-                    const auto nPoints =
-                        listOfRingsValues->value_length(nRingOffset + k);
+                    const auto nPoints = panRingOffsets[nRingOffset + k + 1] -
+                                         panRingOffsets[nRingOffset + k];
                     const auto nPointOffset =
-                        listOfRingsValues->value_offset(nRingOffset + k) * nDim;
+                        panRingOffsets[nRingOffset + k] * nDim;
                     auto poRing = new OGRLinearRing();
                     if (nPoints)
                     {
@@ -2518,7 +3247,6 @@ inline void OGRArrowLayer::ResetReading()
     m_bEOF = false;
     m_nFeatureIdx = 0;
     m_nIdxInBatch = 0;
-    m_poReadFeatureTmpArray.reset();
     if (m_iRecordBatch != 0)
     {
         m_iRecordBatch = -1;
@@ -2588,7 +3316,7 @@ static bool FillTargetValueFromSrcExpr(const OGRFieldDefn *poFieldDefn,
                 psConstraint->sValue.Integer =
                     static_cast<int>(poSrcValue->int_value);
             psConstraint->osValue =
-                std::to_string(psConstraint->sValue.Integer);
+                CPLSPrintf("%d", psConstraint->sValue.Integer);
             break;
 
         case OFTInteger64:
@@ -2599,13 +3327,14 @@ static bool FillTargetValueFromSrcExpr(const OGRFieldDefn *poFieldDefn,
             else
                 psConstraint->sValue.Integer64 = poSrcValue->int_value;
             psConstraint->osValue =
-                std::to_string(psConstraint->sValue.Integer64);
+                CPLSPrintf(CPL_FRMT_GIB, psConstraint->sValue.Integer64);
             break;
 
         case OFTReal:
             psConstraint->eType = OGRArrowLayer::Constraint::Type::Real;
             psConstraint->sValue.Real = poSrcValue->float_value;
-            psConstraint->osValue = std::to_string(psConstraint->sValue.Real);
+            psConstraint->osValue =
+                CPLSPrintf("%f", psConstraint->sValue.Real);
             break;
 
         case OFTString:
@@ -2661,11 +3390,12 @@ static bool FillTargetValueFromSrcExpr(const OGRFieldDefn *poFieldDefn,
 
 inline void OGRArrowLayer::ComputeConstraintsArrayIdx()
 {
+    const int nFIDField = m_poFeatureDefn->GetFieldCount() + SPF_FID;
     for (auto &constraint : m_asAttributeFilterConstraints)
     {
         if (m_bIgnoredFields)
         {
-            if (constraint.iField == m_poFeatureDefn->GetFieldCount() + SPF_FID)
+            if (constraint.iField == nFIDField)
             {
                 constraint.iArrayIdx = m_nRequestedFIDColumn;
                 if (constraint.iArrayIdx < 0 && m_osFIDColumn.empty())
@@ -2681,8 +3411,7 @@ inline void OGRArrowLayer::ComputeConstraintsArrayIdx()
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Constraint on field %s cannot be applied due to "
                          "it being ignored",
-                         constraint.iField ==
-                                 m_poFeatureDefn->GetFieldCount() + SPF_FID
+                         constraint.iField == nFIDField
                              ? m_osFIDColumn.c_str()
                              : m_poFeatureDefn->GetFieldDefn(constraint.iField)
                                    ->GetNameRef());
@@ -2690,12 +3419,12 @@ inline void OGRArrowLayer::ComputeConstraintsArrayIdx()
         }
         else
         {
-            if (constraint.iField == m_poFeatureDefn->GetFieldCount() + SPF_FID)
+            if (constraint.iField == nFIDField)
             {
                 constraint.iArrayIdx = m_iFIDArrowColumn;
                 if (constraint.iArrayIdx < 0 && !m_osFIDColumn.empty())
                 {
-                    CPLDebug(GetDriverUCName().c_str(),
+                    CPLDebug(GetDriverUCNameCached().c_str(),
                              "Constraint on field %s cannot be applied",
                              m_osFIDColumn.c_str());
                 }
@@ -2707,6 +3436,23 @@ inline void OGRArrowLayer::ComputeConstraintsArrayIdx()
             }
         }
     }
+
+    if (m_poBatch)
+        RefreshConstraintsNullness();
+}
+
+/***********************************************************************/
+/*                   RefreshConstraintsNullness()                      */
+/***********************************************************************/
+
+inline void OGRArrowLayer::RefreshConstraintsNullness()
+{
+    for (auto &constraint : m_asAttributeFilterConstraints)
+    {
+        constraint.bHasNulls =
+            constraint.iArrayIdx >= 0 &&
+            m_poBatchColumns[constraint.iArrayIdx]->null_count() != 0;
+    }
 }
 
 /***********************************************************************/
@@ -2715,8 +3461,8 @@ inline void OGRArrowLayer::ComputeConstraintsArrayIdx()
 
 inline void OGRArrowLayer::ExploreExprNode(const swq_expr_node *poNode)
 {
-    const auto AddConstraint = [this](Constraint &constraint)
-    { m_asAttributeFilterConstraints.emplace_back(constraint); };
+    const auto AddConstraint = [this](Constraint &&constraint)
+    { m_asAttributeFilterConstraints.emplace_back(std::move(constraint)); };
 
     if (poNode->eNodeType == SNT_OPERATION && poNode->nOperation == SWQ_AND &&
         poNode->nSubExprCount == 2)
@@ -2730,16 +3476,17 @@ inline void OGRArrowLayer::ExploreExprNode(const swq_expr_node *poNode)
     {
         const swq_expr_node *poColumn = GetColumnSubNode(poNode);
         const swq_expr_node *poValue = GetConstantSubNode(poNode);
+        const int nFieldCount = m_poFeatureDefn->GetFieldCount();
         if (poColumn != nullptr && poValue != nullptr &&
-            (poColumn->field_index < m_poFeatureDefn->GetFieldCount() ||
-             poColumn->field_index ==
-                 m_poFeatureDefn->GetFieldCount() + SPF_FID))
+            (poColumn->field_index < nFieldCount ||
+             poColumn->field_index == nFieldCount + SPF_FID))
         {
-            const OGRFieldDefn oDummyFIDFieldDefn(m_osFIDColumn.c_str(),
-                                                  OFTInteger64);
+            // Only the type of this dummy definition matters to
+            // FillTargetValueFromSrcExpr(): no need to set the actual
+            // FID column name on it at each call.
+            static const OGRFieldDefn oDummyFIDFieldDefn("", OFTInteger64);
             const OGRFieldDefn *poFieldDefn =
-                (poColumn->field_index ==
-                 m_poFeatureDefn->GetFieldCount() + SPF_FID)
+                (poColumn->field_index == nFieldCount + SPF_FID)
                     ? &oDummyFIDFieldDefn
                     : m_poFeatureDefn->GetFieldDefn(poColumn->field_index);
 
@@ -2781,7 +3528,7 @@ inline void OGRArrowLayer::ExploreExprNode(const swq_expr_node *poNode)
                     }
                 }
 
-                AddConstraint(constraint);
+                AddConstraint(std::move(constraint));
             }
         }
     }
@@ -2796,7 +3543,7 @@ inline void OGRArrowLayer::ExploreExprNode(const swq_expr_node *poNode)
             Constraint constraint;
             constraint.iField = poColumn->field_index;
             constraint.nOperation = poNode->nOperation;
-            AddConstraint(constraint);
+            AddConstraint(std::move(constraint));
         }
     }
 
@@ -2813,7 +3560,7 @@ inline void OGRArrowLayer::ExploreExprNode(const swq_expr_node *poNode)
             Constraint constraint;
             constraint.iField = poColumn->field_index;
             constraint.nOperation = SWQ_ISNOTNULL;
-            AddConstraint(constraint);
+            AddConstraint(std::move(constraint));
         }
     }
 }
@@ -2825,6 +3572,7 @@ inline void OGRArrowLayer::ExploreExprNode(const swq_expr_node *poNode)
 inline OGRErr OGRArrowLayer::SetAttributeFilter(const char *pszFilter)
 {
     m_asAttributeFilterConstraints.clear();
+    m_nCachedUseRecordBatchBaseImpl = -1;
 
     // When changing filters, we need to invalidate cached batches, as
     // PostFilterArrowArray() has potentially modified array contents
@@ -2840,7 +3588,8 @@ inline OGRErr OGRArrowLayer::SetAttributeFilter(const char *pszFilter)
         if (m_nUseOptimizedAttributeFilter < 0)
         {
             m_nUseOptimizedAttributeFilter = CPLTestBool(CPLGetConfigOption(
-                ("OGR_" + GetDriverUCName() + "_OPTIMIZED_ATTRIBUTE_FILTER")
+                ("OGR_" + GetDriverUCNameCached() +
+                 "_OPTIMIZED_ATTRIBUTE_FILTER")
                     .c_str(),
                 "YES"));
         }
@@ -2898,50 +3647,21 @@ template <class T> struct Compare<T, T> : public CompareGeneric<T, T>
 };
 template <> struct Compare<int, GIntBig> : public CompareGeneric<int, GIntBig>
 {
-};
-template <> struct Compare<double, GIntBig>
-{
-    static inline bool get(int op, double val1, GIntBig val2)
-    {
-        return CompareGeneric<double, double>::get(op, val1,
-                                                   static_cast<double>(val2));
-    }
-};
-template <> struct Compare<GIntBig, int> : public CompareGeneric<GIntBig, int>
-{
-};
-template <> struct Compare<double, int> : public CompareGeneric<double, int>
-{
-};
-
-template <class T>
-static bool ConstraintEvaluator(const OGRArrowLayer::Constraint &constraint,
-                                const T value)
-{
-    bool b = false;
-    switch (constraint.eType)
-    {
-        case OGRArrowLayer::Constraint::Type::Integer:
-            b = Compare<T, int>::get(constraint.nOperation, value,
-                                     constraint.sValue.Integer);
-            break;
-        case OGRArrowLayer::Constraint::Type::Integer64:
-            b = Compare<T, GIntBig>::get(constraint.nOperation, value,
-                                         constraint.sValue.Integer64);
-            break;
-        case OGRArrowLayer::Constraint::Type::Real:
-            b = Compare<double, double>::get(constraint.nOperation,
-                                             static_cast<double>(value),
-                                             constraint.sValue.Real);
-            break;
-        case OGRArrowLayer::Constraint::Type::String:
-            b = Compare<std::string, std::string>::get(constraint.nOperation,
-                                                       std::to_string(value),
-                                                       constraint.osValue);
-            break;
+};
+template <> struct Compare<double, GIntBig>
+{
+    static inline bool get(int op, double val1, GIntBig val2)
+    {
+        return CompareGeneric<double, double>::get(op, val1,
+                                                   static_cast<double>(val2));
     }
-    return b;
-}
+};
+template <> struct Compare<GIntBig, int> : public CompareGeneric<GIntBig, int>
+{
+};
+template <> struct Compare<double, int> : public CompareGeneric<double, int>
+{
+};
 
 struct StringView
 {
@@ -2960,6 +3680,11 @@ inline bool CompareStr(int op, const StringView &val1, const std::string &val2)
         return val1.m_len == val2.size() &&
                memcmp(val1.m_ptr, val2.data(), val1.m_len) == 0;
     }
+    if (op == SWQ_NE)
+    {
+        return val1.m_len != val2.size() ||
+               memcmp(val1.m_ptr, val2.data(), val1.m_len) != 0;
+    }
     const int cmpRes = val2.compare(0, val2.size(), val1.m_ptr, val1.m_len);
     switch (op)
     {
@@ -2967,8 +3692,7 @@ inline bool CompareStr(int op, const StringView &val1, const std::string &val2)
             return cmpRes >= 0;
         case SWQ_LT:
             return cmpRes > 0;
-        case SWQ_NE:
-            return cmpRes != 0;
+        // case SWQ_NE: return cmpRes != 0;
         // case SWQ_EQ: return cmpRes == 0;
         case SWQ_GE:
             return cmpRes <= 0;
@@ -2981,12 +3705,154 @@ inline bool CompareStr(int op, const StringView &val1, const std::string &val2)
     return true;
 }
 
+// Format a numeric value like std::to_string() does, but into
+// CPLSPrintf()'s rotating buffer rather than a heap-allocated string.
+inline const char *FormatForStrComparison(int nVal)
+{
+    return CPLSPrintf("%d", nVal);
+}
+
+inline const char *FormatForStrComparison(GIntBig nVal)
+{
+    return CPLSPrintf(CPL_FRMT_GIB, nVal);
+}
+
+inline const char *FormatForStrComparison(double dfVal)
+{
+    return CPLSPrintf("%f", dfVal);
+}
+
+template <class T>
+static bool ConstraintEvaluator(const OGRArrowLayer::Constraint &constraint,
+                                const T value)
+{
+    bool b = false;
+    switch (constraint.eType)
+    {
+        case OGRArrowLayer::Constraint::Type::Integer:
+            b = Compare<T, int>::get(constraint.nOperation, value,
+                                     constraint.sValue.Integer);
+            break;
+        case OGRArrowLayer::Constraint::Type::Integer64:
+            b = Compare<T, GIntBig>::get(constraint.nOperation, value,
+                                         constraint.sValue.Integer64);
+            break;
+        case OGRArrowLayer::Constraint::Type::Real:
+            b = Compare<double, double>::get(constraint.nOperation,
+                                             static_cast<double>(value),
+                                             constraint.sValue.Real);
+            break;
+        case OGRArrowLayer::Constraint::Type::String:
+        {
+            // Mismatched numeric column against a string constraint:
+            // rare, but avoid a heap allocation per evaluated row.
+            const char *pszVal = FormatForStrComparison(value);
+            b = CompareStr(constraint.nOperation,
+                           StringView(pszVal, strlen(pszVal)),
+                           constraint.osValue);
+            break;
+        }
+    }
+    return b;
+}
+
 inline bool ConstraintEvaluator(const OGRArrowLayer::Constraint &constraint,
                                 const StringView &value)
 {
     return CompareStr(constraint.nOperation, value, constraint.osValue);
 }
 
+// Row evaluators bound to a column type, so that
+// SkipToNextFeatureDueToAttributeFilter() dispatches on the type once
+// per constraint rather than once per row.
+
+bool EvaluateRowPass(const OGRArrowLayer::Constraint &,
+                     const arrow::Array *, int64_t)
+{
+    return true;
+}
+
+template <class ArrayType, class T>
+bool EvaluateRow(const OGRArrowLayer::Constraint &constraint,
+                 const arrow::Array *array, int64_t nIdx)
+{
+    return ConstraintEvaluator(
+        constraint,
+        static_cast<T>(static_cast<const ArrayType *>(array)->Value(nIdx)));
+}
+
+bool EvaluateRowHalfFloat(const OGRArrowLayer::Constraint &constraint,
+                          const arrow::Array *array, int64_t nIdx)
+{
+    const float f = GetHalfFloatValue(
+        static_cast<const arrow::HalfFloatArray *>(array)->Value(nIdx));
+    return ConstraintEvaluator(constraint, static_cast<double>(f));
+}
+
+bool EvaluateRowString(const OGRArrowLayer::Constraint &constraint,
+                       const arrow::Array *array, int64_t nIdx)
+{
+    const auto castArray = static_cast<const arrow::StringArray *>(array);
+    int out_length = 0;
+    const uint8_t *data = castArray->GetValue(nIdx, &out_length);
+    return ConstraintEvaluator(
+        constraint,
+        StringView(reinterpret_cast<const char *>(data), out_length));
+}
+
+template <class ArrayType>
+bool EvaluateRowDecimal(const OGRArrowLayer::Constraint &constraint,
+                        const arrow::Array *array, int64_t nIdx)
+{
+    const auto castArray = static_cast<const ArrayType *>(array);
+    return ConstraintEvaluator(
+        constraint,
+        GetDecimalAsDouble(castArray, static_cast<size_t>(nIdx),
+                           constraint.nDecimalScale));
+}
+
+OGRArrowLayer::Constraint::RowEvaluatorType
+GetRowEvaluator(const arrow::Type::type typeId)
+{
+    switch (typeId)
+    {
+        case arrow::Type::BOOL:
+            return EvaluateRow<arrow::BooleanArray, int>;
+        case arrow::Type::UINT8:
+            return EvaluateRow<arrow::UInt8Array, int>;
+        case arrow::Type::INT8:
+            return EvaluateRow<arrow::Int8Array, int>;
+        case arrow::Type::UINT16:
+            return EvaluateRow<arrow::UInt16Array, int>;
+        case arrow::Type::INT16:
+            return EvaluateRow<arrow::Int16Array, int>;
+        case arrow::Type::UINT32:
+            return EvaluateRow<arrow::UInt32Array, GIntBig>;
+        case arrow::Type::INT32:
+            return EvaluateRow<arrow::Int32Array, int>;
+        case arrow::Type::UINT64:
+            return EvaluateRow<arrow::UInt64Array, double>;
+        case arrow::Type::INT64:
+            return EvaluateRow<arrow::Int64Array, GIntBig>;
+        case arrow::Type::HALF_FLOAT:
+            return EvaluateRowHalfFloat;
+        case arrow::Type::FLOAT:
+            return EvaluateRow<arrow::FloatArray, double>;
+        case arrow::Type::DOUBLE:
+            return EvaluateRow<arrow::DoubleArray, double>;
+        case arrow::Type::STRING:
+            return EvaluateRowString;
+        case arrow::Type::DECIMAL128:
+            return EvaluateRowDecimal<arrow::Decimal128Array>;
+        case arrow::Type::DECIMAL256:
+            return EvaluateRowDecimal<arrow::Decimal256Array>;
+        default:
+            // Same as the former per-row switch: unhandled types never
+            // cause a skip
+            return EvaluateRowPass;
+    }
+}
+
 }  // namespace
 
 /************************************************************************/
@@ -2995,13 +3861,12 @@ inline bool ConstraintEvaluator(const OGRArrowLayer::Constraint &constraint,
 
 inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
 {
+    const int nFIDField = m_poFeatureDefn->GetFieldCount() + SPF_FID;
     for (const auto &constraint : m_asAttributeFilterConstraints)
     {
         if (constraint.iArrayIdx < 0)
         {
-            if (constraint.iField ==
-                    m_poFeatureDefn->GetFieldCount() + SPF_FID &&
-                m_osFIDColumn.empty())
+            if (constraint.iField == nFIDField && m_osFIDColumn.empty())
             {
                 if (!ConstraintEvaluator(constraint,
                                          static_cast<GIntBig>(m_nFeatureIdx)))
@@ -3022,7 +3887,8 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
         const arrow::Array *array =
             m_poBatchColumns[constraint.iArrayIdx].get();
 
-        const bool bIsNull = array->IsNull(m_nIdxInBatch);
+        const bool bIsNull =
+            constraint.bHasNulls && array->IsNull(m_nIdxInBatch);
         if (constraint.nOperation == SWQ_ISNULL)
         {
             if (bIsNull)
@@ -3044,200 +3910,18 @@ inline bool OGRArrowLayer::SkipToNextFeatureDueToAttributeFilter() const
             return true;
         }
 
-        switch (array->type_id())
+        auto &pfnRowEvaluator = constraint.pfnRowEvaluator;
+        if (pfnRowEvaluator == nullptr)
         {
-            case arrow::Type::NA:
-                break;
-
-            case arrow::Type::BOOL:
-            {
-                const auto castArray =
-                    static_cast<const arrow::BooleanArray *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::UINT8:
-            {
-                const auto castArray =
-                    static_cast<const arrow::UInt8Array *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::INT8:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Int8Array *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::UINT16:
-            {
-                const auto castArray =
-                    static_cast<const arrow::UInt16Array *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::INT16:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Int16Array *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        static_cast<int>(castArray->Value(m_nIdxInBatch))))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::UINT32:
-            {
-                const auto castArray =
-                    static_cast<const arrow::UInt32Array *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        static_cast<GIntBig>(castArray->Value(m_nIdxInBatch))))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::INT32:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Int32Array *>(array);
-                if (!ConstraintEvaluator(constraint,
-                                         castArray->Value(m_nIdxInBatch)))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::UINT64:
-            {
-                const auto castArray =
-                    static_cast<const arrow::UInt64Array *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        static_cast<double>(castArray->Value(m_nIdxInBatch))))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::INT64:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Int64Array *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        static_cast<GIntBig>(castArray->Value(m_nIdxInBatch))))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::HALF_FLOAT:
-            {
-                const auto castArray =
-                    static_cast<const arrow::HalfFloatArray *>(array);
-                const uint16_t nFloat16 = castArray->Value(m_nIdxInBatch);
-                uint32_t nFloat32 = CPLHalfToFloat(nFloat16);
-                float f;
-                memcpy(&f, &nFloat32, sizeof(nFloat32));
-                if (!ConstraintEvaluator(constraint, static_cast<double>(f)))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::FLOAT:
-            {
-                const auto castArray =
-                    static_cast<const arrow::FloatArray *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        static_cast<double>(castArray->Value(m_nIdxInBatch))))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::DOUBLE:
-            {
-                const auto castArray =
-                    static_cast<const arrow::DoubleArray *>(array);
-                if (!ConstraintEvaluator(constraint,
-                                         castArray->Value(m_nIdxInBatch)))
-                {
-                    return true;
-                }
-                break;
-            }
-            case arrow::Type::STRING:
-            {
-                const auto castArray =
-                    static_cast<const arrow::StringArray *>(array);
-                int out_length = 0;
-                const uint8_t *data =
-                    castArray->GetValue(m_nIdxInBatch, &out_length);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        StringView(reinterpret_cast<const char *>(data),
-                                   out_length)))
-                {
-                    return true;
-                }
-                break;
-            }
-
-            case arrow::Type::DECIMAL128:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Decimal128Array *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        CPLAtof(castArray->FormatValue(m_nIdxInBatch).c_str())))
-                {
-                    return true;
-                }
-                break;
-            }
-
-            case arrow::Type::DECIMAL256:
-            {
-                const auto castArray =
-                    static_cast<const arrow::Decimal256Array *>(array);
-                if (!ConstraintEvaluator(
-                        constraint,
-                        CPLAtof(castArray->FormatValue(m_nIdxInBatch).c_str())))
-                {
-                    return true;
-                }
-                break;
-            }
-
-            default:
-                break;
+            const auto eTypeId = array->type_id();
+            pfnRowEvaluator = GetRowEvaluator(eTypeId);
+            if (eTypeId == arrow::Type::DECIMAL128 ||
+                eTypeId == arrow::Type::DECIMAL256)
+                constraint.nDecimalScale = GetDecimalScale(array);
+        }
+        if (!pfnRowEvaluator(constraint, array, m_nIdxInBatch))
+        {
+            return true;
         }
     }
     return false;
@@ -3259,9 +3943,14 @@ OGRArrowLayer::SetBatch(const std::shared_ptr<arrow::RecordBatch> &poBatch)
     m_poArrayMinY = nullptr;
     m_poArrayMaxX = nullptr;
     m_poArrayMaxY = nullptr;
+    m_bArrayWKBMayBeNull = false;
+    m_bArrayBBOXMayBeNull = false;
 
     if (m_poBatch)
+    {
         m_poBatchColumns = m_poBatch->columns();
+        RefreshConstraintsNullness();
+    }
 
     if (m_poBatch && m_poFilterGeom)
     {
@@ -3289,9 +3978,7 @@ OGRArrowLayer::SetBatch(const std::shared_ptr<arrow::RecordBatch> &poBatch)
             }
 
             if (m_iBBOXMinXField >= 0 && m_iBBOXMinYField >= 0 &&
-                m_iBBOXMaxXField >= 0 && m_iBBOXMaxYField >= 0 &&
-                CPLTestBool(CPLGetConfigOption(
-                    ("OGR_" + GetDriverUCName() + "_USE_BBOX").c_str(), "YES")))
+                m_iBBOXMaxXField >= 0 && m_iBBOXMaxYField >= 0 && UseBBOX())
             {
                 const auto GetArray =
                     [this](int idx, const arrow::Array *&poStructArray)
@@ -3366,6 +4053,16 @@ OGRArrowLayer::SetBatch(const std::shared_ptr<arrow::RecordBatch> &poBatch)
                     m_poArrayMaxY = nullptr;
                 }
             }
+
+            // Cache null presence so that the spatial filter evaluation
+            // loop of GetNextRawFeature() can skip per-row validity
+            // bitmap lookups in the common all-valid case.
+            m_bArrayWKBMayBeNull =
+                (m_poArrayWKB && m_poArrayWKB->null_count() != 0) ||
+                (m_poArrayWKBLarge && m_poArrayWKBLarge->null_count() != 0);
+            m_bArrayBBOXMayBeNull =
+                (m_poArrayBBOX && m_poArrayBBOX->null_count() != 0) ||
+                (m_poArrayMinX && m_poArrayMinX->null_count() != 0);
         }
     }
 }
@@ -3408,18 +4105,20 @@ inline OGRFeature *OGRArrowLayer::GetNextRawFeature()
             while (true)
             {
                 bool bSkipToNextFeature = false;
-                if ((m_poArrayWKB && m_poArrayWKB->IsNull(m_nIdxInBatch)) ||
-                    (m_poArrayWKBLarge &&
-                     m_poArrayWKBLarge->IsNull(m_nIdxInBatch)))
+                if (m_bArrayWKBMayBeNull &&
+                    ((m_poArrayWKB && m_poArrayWKB->IsNull(m_nIdxInBatch)) ||
+                     (m_poArrayWKBLarge &&
+                      m_poArrayWKBLarge->IsNull(m_nIdxInBatch))))
                 {
                     bSkipToNextFeature = true;
                 }
                 else
                 {
                     if (m_poArrayMinX &&
-                        (!m_poArrayBBOX ||
-                         !m_poArrayBBOX->IsNull(m_nIdxInBatch)) &&
-                        !m_poArrayMinX->IsNull(m_nIdxInBatch))
+                        (!m_bArrayBBOXMayBeNull ||
+                         ((!m_poArrayBBOX ||
+                           !m_poArrayBBOX->IsNull(m_nIdxInBatch)) &&
+                          !m_poArrayMinX->IsNull(m_nIdxInBatch))))
                     {
                         sEnvelope.MinX = m_poArrayMinX->Value(m_nIdxInBatch);
                         sEnvelope.MinY = m_poArrayMinY->Value(m_nIdxInBatch);
@@ -3435,7 +4134,10 @@ inline OGRFeature *OGRArrowLayer::GetNextRawFeature()
                         int out_length = 0;
                         const uint8_t *data =
                             m_poArrayWKB->GetValue(m_nIdxInBatch, &out_length);
-                        if (OGRWKBGetBoundingBox(data, out_length, sEnvelope) &&
+                        if ((OGRWKBPointGetBoundingBoxFast(data, out_length,
+                                                           sEnvelope) ||
+                             OGRWKBGetBoundingBox(data, out_length,
+                                                  sEnvelope)) &&
                             !m_sFilterEnvelope.Intersects(sEnvelope))
                         {
                             bSkipToNextFeature = true;
@@ -3448,9 +4150,12 @@ inline OGRFeature *OGRArrowLayer::GetNextRawFeature()
                         const uint8_t *data = m_poArrayWKBLarge->GetValue(
                             m_nIdxInBatch, &out_length64);
                         if (out_length64 < INT_MAX &&
-                            OGRWKBGetBoundingBox(data,
-                                                 static_cast<int>(out_length64),
-                                                 sEnvelope) &&
+                            (OGRWKBPointGetBoundingBoxFast(
+                                 data, static_cast<size_t>(out_length64),
+                                 sEnvelope) ||
+                             OGRWKBGetBoundingBox(
+                                 data, static_cast<int>(out_length64),
+                                 sEnvelope)) &&
                             !m_sFilterEnvelope.Intersects(sEnvelope))
                         {
                             bSkipToNextFeature = true;
@@ -3515,6 +4220,7 @@ inline OGRFeature *OGRArrowLayer::GetNextRawFeature()
                 if (!listOfPartsArray->IsNull(m_nIdxInBatch))
                 {
                     OGREnvelope sEnvelope;
+                    bool bIntersects = false;
                     const auto nParts =
                         listOfPartsArray->value_length(m_nIdxInBatch);
                     const auto nPartOffset =
@@ -3534,17 +4240,22 @@ inline OGRFeature *OGRArrowLayer::GetNextRawFeature()
                                 nDim;
                             const double *padfRawValue =
                                 pointValues->raw_values() + nPointOffset;
-                            for (auto l = decltype(nPoints){0}; l < nPoints;
-                                 ++l)
+                            MergePointsEnvelope(padfRawValue, nDim, nPoints,
+                                                sEnvelope);
+                            // for bounding box, only the first ring matters
+
+                            // The envelope can only grow: once it
+                            // intersects the filter envelope, it will
+                            // whatever the remaining parts contain
+                            if (m_sFilterEnvelope.Intersects(sEnvelope))
                             {
-                                sEnvelope.Merge(padfRawValue[nDim * l],
-                                                padfRawValue[nDim * l + 1]);
+                                bIntersects = true;
+                                break;
                             }
-                            // for bounding box, only the first ring matters
                         }
                     }
 
-                    if (nParts != 0 && m_sFilterEnvelope.Intersects(sEnvelope))
+                    if (bIntersects)
                     {
                         break;
                     }
@@ -3703,6 +4414,7 @@ inline void OGRArrowLayer::SetSpatialFilter(int iGeomField,
     if (m_poFilterGeom)
         InvalidateCachedBatches();
 
+    m_nCachedUseRecordBatchBaseImpl = -1;
     m_bSpatialFilterIntersectsLayerExtent = true;
     if (iGeomField < GetLayerDefn()->GetGeomFieldCount())
     {
@@ -3723,6 +4435,16 @@ inline void OGRArrowLayer::SetSpatialFilter(int iGeomField,
     SetBatch(m_poBatch);
 }
 
+/************************************************************************/
+/*                        SetIgnoredFields()                            */
+/************************************************************************/
+
+inline OGRErr OGRArrowLayer::SetIgnoredFields(const char **papszFields)
+{
+    m_nCachedUseRecordBatchBaseImpl = -1;
+    return OGRLayer::SetIgnoredFields(papszFields);
+}
+
 /************************************************************************/
 /*                         FastGetExtent()                              */
 /************************************************************************/
@@ -3742,9 +4464,7 @@ inline bool OGRArrowLayer::FastGetExtent(int iGeomField,
     const char *pszGeomFieldName =
         m_poFeatureDefn->GetGeomFieldDefn(iGeomField)->GetNameRef();
     const auto oIter = m_oMapGeometryColumns.find(pszGeomFieldName);
-    if (oIter != m_oMapGeometryColumns.end() &&
-        CPLTestBool(CPLGetConfigOption(
-            ("OGR_" + GetDriverUCName() + "_USE_BBOX").c_str(), "YES")))
+    if (oIter != m_oMapGeometryColumns.end() && UseBBOX())
     {
         const auto &oJSONDef = oIter->second;
         if (GetExtentFromMetadata(oJSONDef, psExtent) == OGRERR_NONE)
@@ -3937,11 +4657,8 @@ inline OGRErr OGRArrowLayer::GetExtent(int iGeomField, OGREnvelope *psExtent,
                             listOfRingsValues->value_offset(nRingOffset) * nDim;
                         const double *padfRawValue =
                             pointValues->raw_values() + nPointOffset;
-                        for (auto l = decltype(nPoints){0}; l < nPoints; ++l)
-                        {
-                            psExtent->Merge(padfRawValue[nDim * l],
-                                            padfRawValue[nDim * l + 1]);
-                        }
+                        MergePointsEnvelope(padfRawValue, nDim, nPoints,
+                                            *psExtent);
                         // for bounding box, only the first ring matters
                     }
                 }
@@ -4021,6 +4738,25 @@ inline bool OGRArrowLayer::UseRecordBatchBaseImplementation() const
         return true;
     }
 
+    // The computation, in particular the schema export and
+    // CanPostFilterArrowArray() walk, only depends on the filters, the
+    // ignored fields and the Arrow stream options, so its result is
+    // cached until one of those changes. This matters for callers that
+    // probe TestCapability(OLCFastGetArrowStream) repeatedly.
+    if (m_nCachedUseRecordBatchBaseImpl < 0)
+    {
+        m_nCachedUseRecordBatchBaseImpl =
+            static_cast<int>(ComputeUseRecordBatchBaseImplementation());
+    }
+    return m_nCachedUseRecordBatchBaseImpl != 0;
+}
+
+/************************************************************************/
+/*                ComputeUseRecordBatchBaseImplementation()             */
+/************************************************************************/
+
+inline bool OGRArrowLayer::ComputeUseRecordBatchBaseImplementation() const
+{
     if (EQUAL(m_aosArrowArrayStreamOptions.FetchNameValueDef(
                   "GEOMETRY_ENCODING", ""),
               "WKB"))
@@ -4093,7 +4829,24 @@ inline bool OGRArrowLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
     if (!OGRLayer::GetArrowStream(out_stream, papszOptions))
         return false;
 
+    // The base implementation has just updated
+    // m_aosArrowArrayStreamOptions
+    m_nCachedUseRecordBatchBaseImpl = -1;
     m_bUseRecordBatchBaseImplementation = UseRecordBatchBaseImplementation();
+    m_bConvertWKTToWKB = false;
+    if (EQUAL(m_aosArrowArrayStreamOptions.FetchNameValueDef(
+                  "GEOMETRY_ENCODING", ""),
+              "WKB"))
+    {
+        for (const auto eGeomEncoding : m_aeGeomEncoding)
+        {
+            if (eGeomEncoding == OGRArrowGeomEncoding::WKT)
+            {
+                m_bConvertWKTToWKB = true;
+                break;
+            }
+        }
+    }
     return true;
 }
 
@@ -4310,9 +5063,7 @@ inline int OGRArrowLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             }
         }
 
-        struct ArrowSchema schema;
-        memset(&schema, 0, sizeof(schema));
-        auto status = arrow::ExportRecordBatch(*m_poBatch, out_array, &schema);
+        auto status = arrow::ExportRecordBatch(*m_poBatch, out_array);
         m_nIdxInBatch = m_poBatch->num_rows();
         if (!status.ok())
         {
@@ -4322,9 +5073,7 @@ inline int OGRArrowLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             return EIO;
         }
 
-        if (EQUAL(m_aosArrowArrayStreamOptions.FetchNameValueDef(
-                      "GEOMETRY_ENCODING", ""),
-                  "WKB"))
+        if (m_bConvertWKTToWKB)
         {
             const int nGeomFieldCount = m_poFeatureDefn->GetGeomFieldCount();
             for (int i = 0; i < nGeomFieldCount; i++)
@@ -4341,7 +5090,8 @@ inline int OGRArrowLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                 : m_anMapGeomFieldIndexToArrowColumn[i];
                         auto sourceArray = out_array->children[nArrayIdx];
                         auto targetArray =
-                            strcmp(schema.children[nArrayIdx]->format, "u") == 0
+                            m_poBatch->column(nArrayIdx)->type_id() ==
+                                    arrow::Type::STRING
                                 ? CreateWKBArrayFromWKTArray<uint32_t>(
                                       sourceArray)
                                 : CreateWKBArrayFromWKTArray<uint64_t>(
@@ -4356,8 +5106,6 @@ inline int OGRArrowLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                         {
                             out_array->release(out_array);
                             memset(out_array, 0, sizeof(*out_array));
-                            if (schema.release)
-                                schema.release(&schema);
                             return ENOMEM;
                         }
                     }
@@ -4371,9 +5119,6 @@ inline int OGRArrowLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             }
         }
 
-        if (schema.release)
-            schema.release(&schema);
-
         OverrideArrowRelease(m_poArrowDS, out_array);
 
         const auto nFeatureIdxCur = m_nFeatureIdx;
@@ -4495,18 +5240,30 @@ OGRArrowLayer::CreateWKBArrayFromWKTArray(const struct ArrowArray *sourceArray)
             targetArray->null_count = sourceArray->null_count;
             targetNull = static_cast<uint8_t *>(
                 const_cast<void *>(targetArray->buffers[0]));
-            if (nOffset == 0)
+            const size_t nShift = nOffset % 8;
+            const uint8_t *pabySrc = sourceNull + nOffset / 8;
+            const size_t nTargetBytes = (nLength + 7) / 8;
+            if (nShift == 0)
             {
-                memcpy(targetNull, sourceNull, (nLength + 7) / 8);
+                memcpy(targetNull, pabySrc, nTargetBytes);
             }
             else
             {
-                memset(targetNull, 0, (nLength + 7) / 8);
-                for (size_t i = 0; i < nLength; ++i)
+                // Copy the source bits [nOffset, nOffset + nLength) to
+                // the front of the target bitmap, one output byte at a
+                // time, rather than bit by bit. Do not read beyond the
+                // byte holding the last source bit, as it may be the
+                // last one of the source buffer.
+                const uint8_t *pabySrcLast =
+                    sourceNull + (nOffset + nLength - 1) / 8;
+                for (size_t i = 0; i < nTargetBytes; ++i)
                 {
-                    if ((sourceNull[(i + nOffset) / 8] >> ((i + nOffset) % 8)) &
-                        1)
-                        targetNull[i / 8] |= (1 << (i % 8));
+                    uint8_t nByte =
+                        static_cast<uint8_t>(pabySrc[i] >> nShift);
+                    if (pabySrc + i + 1 <= pabySrcLast)
+                        nByte = static_cast<uint8_t>(
+                            nByte | (pabySrc[i + 1] << (8 - nShift)));
+                    targetNull[i] = nByte;
                 }
             }
         }
@@ -4516,10 +5273,21 @@ OGRArrowLayer::CreateWKBArrayFromWKTArray(const struct ArrowArray *sourceArray)
     targetArray->buffers[1] =
         VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(uint32_t) * (1 + nLength));
 
-    // Allocate data (WKB) buffer
+    const auto sourceOffsets =
+        static_cast<const SourceOffset *>(sourceArray->buffers[1]) + nOffset;
+
+    // Allocate data (WKB) buffer. For geometries with more than a
+    // handful of vertices, the WKB encoding is smaller than the WKT
+    // one, so sizing the buffer from the total WKT size (in addition
+    // to the fixed per-row estimate, which dominates for small
+    // geometries and mostly-null arrays) makes Grow() reallocations
+    // unlikely.
     constexpr size_t DEFAULT_WKB_SIZE = 100;
+    const size_t nTotalWKTSize =
+        static_cast<size_t>(sourceOffsets[nLength] - sourceOffsets[0]);
     uint32_t nInitialCapacity = static_cast<uint32_t>(std::min<size_t>(
-        std::numeric_limits<int32_t>::max(), DEFAULT_WKB_SIZE * nLength));
+        std::numeric_limits<int32_t>::max(),
+        std::max(DEFAULT_WKB_SIZE * nLength, nTotalWKTSize)));
     targetArray->buffers[2] = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nInitialCapacity);
 
     // Check buffers have been allocated
@@ -4534,12 +5302,11 @@ OGRArrowLayer::CreateWKBArrayFromWKTArray(const struct ArrowArray *sourceArray)
     OGRArrowLayerAppendBuffer oOGRAppendBuffer(targetArray, nInitialCapacity);
     OGRWKTToWKBTranslator oTranslator(oOGRAppendBuffer);
 
-    const auto sourceOffsets =
-        static_cast<const SourceOffset *>(sourceArray->buffers[1]) + nOffset;
     auto sourceBytes =
         static_cast<char *>(const_cast<void *>(sourceArray->buffers[2]));
     auto targetOffsets =
         static_cast<uint32_t *>(const_cast<void *>(targetArray->buffers[1]));
+    const SourceOffset nSourceBytesEnd = sourceOffsets[nLength];
     for (size_t i = 0; i < nLength; ++i)
     {
         targetOffsets[i] = static_cast<uint32_t>(oOGRAppendBuffer.GetSize());
@@ -4552,7 +5319,7 @@ OGRArrowLayer::CreateWKBArrayFromWKTArray(const struct ArrowArray *sourceArray)
         const size_t nWKBSize = oTranslator.TranslateWKT(
             sourceBytes + sourceOffsets[i],
             sourceOffsets[i + 1] - sourceOffsets[i],
-            sourceOffsets[i + 1] < sourceOffsets[nLength]);
+            sourceOffsets[i + 1] < nSourceBytesEnd);
         if (nWKBSize == static_cast<size_t>(-1))
         {
             targetArray->release(targetArray);
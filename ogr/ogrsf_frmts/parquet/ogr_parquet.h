@@ -105,7 +105,7 @@ class OGRParquetLayer final : public OGRParquetLayerBase
                                                  int iParquetCol) const;
     void CreateFieldFromSchema(
         const std::shared_ptr<arrow::Field> &field, bool bParquetColValid,
-        int &iParquetCol, const std::vector<int> &path,
+        int &iParquetCol, std::vector<int> &path,
         const std::map<std::string, std::unique_ptr<OGRFieldDefn>>
             &oMapFieldNameToGDALSchemaFieldDefn);
     bool CheckMatchArrowParquetColumnNames(
@@ -460,6 +460,13 @@ void OGRParquetLayer::EstablishFeatureDefn()
 
     const auto fields = m_poSchema->fields();
     const auto poParquetSchema = metadata->schema();
+    // Upper bound: struct fields can expand to more entries, but this
+    // avoids reallocations for the common flat-schema case.
+    m_anMapFieldIndexToArrowColumn.reserve(fields.size());
+    m_poFeatureDefn->ReserveSpaceForFields(static_cast<int>(fields.size()));
+    // Scratch path vector reused across fields to avoid per-field
+    // allocations; CreateFieldFromSchema() mutates and restores it.
+    std::vector<int> anPath;
     int iParquetCol = 0;
     for (int i = 0; i < m_poSchema->num_fields(); ++i)
     {
@@ -509,7 +516,9 @@ void OGRParquetLayer::EstablishFeatureDefn()
         }
         else
         {
-            CreateFieldFromSchema(field, bParquetColValid, iParquetCol, {i},
+            anPath.clear();
+            anPath.push_back(i);
+            CreateFieldFromSchema(field, bParquetColValid, iParquetCol, anPath,
                                   oMapFieldNameToGDALSchemaFieldDefn);
         }
     }
@@ -586,7 +595,7 @@ bool OGRParquetLayer::CheckMatchArrowParquetColumnNames(
 
 void OGRParquetLayer::CreateFieldFromSchema(
     const std::shared_ptr<arrow::Field> &field, bool bParquetColValid,
-    int &iParquetCol, const std::vector<int> &path,
+    int &iParquetCol, std::vector<int> &path,
     const std::map<std::string, std::unique_ptr<OGRFieldDefn>>
         &oMapFieldNameToGDALSchemaFieldDefn)
 {
@@ -625,8 +634,9 @@ void OGRParquetLayer::CreateFieldFromSchema(
         case arrow::Type::STRUCT:
         {
             const auto subfields = field->Flatten();
-            auto newpath = path;
-            newpath.push_back(0);
+            // Mutate-and-restore the path rather than copying it at each
+            // recursion level.
+            path.push_back(0);
             for (int j = 0; j < static_cast<int>(subfields.size()); j++)
             {
                 const auto &subfield = subfields[j];
@@ -634,11 +644,12 @@ void OGRParquetLayer::CreateFieldFromSchema(
                     CheckMatchArrowParquetColumnNames(iParquetCol, subfield);
                 if (!bParquetColValid)
                     m_bHasMissingMappingToParquet = true;
-                newpath.back() = j;
+                path.back() = j;
                 CreateFieldFromSchema(subfield, bParquetColValid, iParquetCol,
-                                      newpath,
+                                      path,
                                       oMapFieldNameToGDALSchemaFieldDefn);
             }
+            path.pop_back();
             return;  // return intended, not break
         }
 
@@ -1057,9 +1068,7 @@ bool OGRParquetLayer::ReadNextBatch()
         std::vector<int> anSelectedGroups;
         const bool bUSEBBOXFields =
             (m_poFilterGeom && m_iBBOXMinXField >= 0 && m_iBBOXMinYField >= 0 &&
-             m_iBBOXMaxXField >= 0 && m_iBBOXMaxYField >= 0 &&
-             CPLTestBool(CPLGetConfigOption(
-                 ("OGR_" + GetDriverUCName() + "_USE_BBOX").c_str(), "YES")));
+             m_iBBOXMaxXField >= 0 && m_iBBOXMaxYField >= 0 && UseBBOX());
 
         if (m_asAttributeFilterConstraints.empty() && !bUSEBBOXFields)
         {
@@ -1452,7 +1461,7 @@ OGRErr OGRParquetLayer::SetIgnoredFields(const char **papszFields)
     m_anMapFieldIndexToArrayIndex.clear();
     m_anMapGeomFieldIndexToArrayIndex.clear();
     m_nRequestedFIDColumn = -1;
-    OGRErr eErr = OGRLayer::SetIgnoredFields(papszFields);
+    OGRErr eErr = OGRArrowLayer::SetIgnoredFields(papszFields);
     if (!m_bHasMissingMappingToParquet && eErr == OGRERR_NONE)
     {
         m_bIgnoredFields = papszFields != nullptr && papszFields[0] != nullptr;
@@ -1615,8 +1624,7 @@ bool OGRParquetLayer::FastGetExtent(int iGeomField, OGREnvelope *psExtent) const
         // bboxy.maxy fields with statistics. Use that to quickly compute
         // extent.
         if (m_iBBOXMinXField >= 0 && m_iBBOXMinYField >= 0 &&
-            m_iBBOXMaxXField >= 0 && m_iBBOXMaxYField >= 0 &&
-            CPLTestBool(CPLGetConfigOption("OGR_PARQUET_USE_BBOX", "YES")))
+            m_iBBOXMaxXField >= 0 && m_iBBOXMaxYField >= 0 && UseBBOX())
         {
             OGREnvelope sExtent;
             OGRField sMin, sMax;
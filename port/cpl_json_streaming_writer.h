@@ -89,6 +89,13 @@ class CPL_DLL CPLJSonStreamingWriter
         return m_osStr;
     }
 
+    // Pre-size the internal string (only relevant when no serialization
+    // function has been passed to the constructor)
+    void Reserve(size_t nCapacity)
+    {
+        m_osStr.reserve(nCapacity);
+    }
+
     void Add(const std::string &str);
     void Add(const char *pszStr);
     void Add(bool bVal);